@@ -0,0 +1,254 @@
+/*
+
+  counters.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#include "counters.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+  #include <errno.h>
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <cpuid.h>
+#endif
+
+
+static const char *const NAMES[COUNTER_EVENTS] = {
+  "cycles", "instr", "br-miss", "L1d-miss", "fp-assist"
+};
+
+
+#ifdef __linux__
+
+/*
+
+  The raw event counting floating point assists, or 0 if there is none known.
+
+  Haswell through Comet Lake call it FP_ASSIST.ANY (event 0xca, umask 0x1e),
+  Ice Lake and later big cores ASSISTS.FP (event 0xc1, umask 0x02). Others,
+  AMD's included, have nothing equivalent that's documented.
+
+*/
+static uint64_t fpAssistEvent(void){
+  const char *env = getenv("MATH_FP_ASSIST_EVENT");
+  if(env) return strtoull(env, NULL, 16);
+
+#if defined(__x86_64__) || defined(__i386__)
+  static const unsigned char FP_ASSIST_ANY[] = {
+    0x3c, 0x3f, 0x45, 0x46, 0x3d, 0x47, 0x4f, 0x56,     // Haswell, Broadwell
+    0x4e, 0x5e, 0x55, 0x8e, 0x9e, 0xa5, 0xa6            // Skylake and kin
+  };
+  static const unsigned char ASSISTS_FP[] = {
+    0x6a, 0x6c, 0x7d, 0x7e, 0x8c, 0x8d, 0x8f, 0x97, 0x9a, 0xb7, 0xba, 0xbf,
+    0xcf
+  };
+
+  unsigned eax, ebx, ecx, edx;
+  if(!__get_cpuid(0, &eax, &ebx, &ecx, &edx)) return 0;
+
+  // "GenuineIntel", in the order cpuid gives it
+  if(ebx != 0x756e6547 || edx != 0x49656e69 || ecx != 0x6c65746e) return 0;
+
+  __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+  unsigned family = (eax >> 8) & 0xf;
+  unsigned model = ((eax >> 4) & 0xf) | ((eax >> 12) & 0xf0);
+  if(family != 6) return 0;
+
+  for(size_t i = 0; i < sizeof(FP_ASSIST_ANY); i++){
+    if(model == FP_ASSIST_ANY[i]) return 0x1eca;
+  }
+  for(size_t i = 0; i < sizeof(ASSISTS_FP); i++){
+    if(model == ASSISTS_FP[i]) return 0x02c1;
+  }
+#endif
+
+  return 0;
+}
+
+
+static int openEvent(uint32_t type, uint64_t config, int leader){
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = leader == -1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                     PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+}
+
+
+int counters_open(struct counters *c){
+  static int warned = 0;
+  uint64_t assist = fpAssistEvent();
+
+  struct { uint32_t type; uint64_t config; } events[COUNTER_EVENTS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                          PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                          PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+    { PERF_TYPE_RAW, assist }
+  };
+
+  c->leader = -1;
+  c->opened = 0;
+  int error = 0;
+
+  for(int i = 0; i < COUNTER_EVENTS; i++){
+    c->fd[i] = -1;
+    if(i == COUNTER_FP_ASSISTS && !assist) continue;
+
+    c->fd[i] = openEvent(events[i].type, events[i].config, c->leader);
+    if(c->fd[i] == -1){
+      if(!error) error = errno;
+      continue;
+    }
+    if(ioctl(c->fd[i], PERF_EVENT_IOC_ID, &c->id[i]) != 0){
+      close(c->fd[i]);
+      c->fd[i] = -1;
+      continue;
+    }
+    if(c->leader == -1) c->leader = c->fd[i];
+    c->opened++;
+  }
+
+  if(!c->opened && !warned){
+    fprintf(stderr, "hardware counters unavailable (%s), timings only\n",
+            strerror(error));
+    warned = 1;
+  }
+  return c->opened;
+}
+
+
+void counters_start(struct counters *c){
+  if(c->leader == -1) return;
+  ioctl(c->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(c->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+
+/*
+
+  The group is read in one go, as the number of events, the times enabled and
+  running, then an (value, id) pair per event. If the group didn't get the
+  counters to itself the whole time the values are scaled up to the time it
+  was enabled, and if it never got them nothing was counted.
+
+*/
+void counters_stop(struct counters *c, struct counter_values *v){
+  for(int i = 0; i < COUNTER_EVENTS; i++) v->count[i] = NAN;
+  if(c->leader == -1) return;
+
+  ioctl(c->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+  uint64_t data[3 + 2*COUNTER_EVENTS];
+  if(read(c->leader, data, sizeof(data)) < (ssize_t)(3*sizeof(uint64_t))){
+    return;
+  }
+  if(data[2] == 0) return;
+  double scale = (double)data[1]/data[2];
+
+  for(uint64_t k = 0; k < data[0] && k < COUNTER_EVENTS; k++){
+    uint64_t value = data[3 + 2*k], id = data[4 + 2*k];
+    for(int i = 0; i < COUNTER_EVENTS; i++){
+      if(c->fd[i] != -1 && c->id[i] == id) v->count[i] = value*scale;
+    }
+  }
+}
+
+
+void counters_close(struct counters *c){
+  for(int i = 0; i < COUNTER_EVENTS; i++){
+    if(c->fd[i] != -1) close(c->fd[i]);
+    c->fd[i] = -1;
+  }
+  c->leader = -1;
+  c->opened = 0;
+}
+
+#else
+
+int counters_open(struct counters *c){
+  static int warned = 0;
+  for(int i = 0; i < COUNTER_EVENTS; i++) c->fd[i] = -1;
+  c->leader = -1;
+  c->opened = 0;
+
+  if(!warned){
+    fprintf(stderr, "hardware counters need Linux, timings only\n");
+    warned = 1;
+  }
+  return 0;
+}
+
+void counters_start(struct counters *c){
+  (void)c;
+}
+
+void counters_stop(struct counters *c, struct counter_values *v){
+  (void)c;
+  for(int i = 0; i < COUNTER_EVENTS; i++) v->count[i] = NAN;
+}
+
+void counters_close(struct counters *c){
+  (void)c;
+}
+
+#endif
+
+
+/*
+
+  Columns are 8 wide for the per value counts of cycles and instructions, 6
+  for IPC and 9 for the rarer events, which get more decimals
+
+*/
+static int width(int i){
+  return i < COUNTER_BRANCH_MISSES ? 8 : 9;
+}
+
+void counters_print_header(FILE *out){
+  for(int i = 0; i < COUNTER_EVENTS; i++){
+    if(i == COUNTER_BRANCH_MISSES) fprintf(out, " %6s", "IPC");
+    fprintf(out, " %*s", width(i), NAMES[i]);
+  }
+}
+
+void counters_print(FILE *out, const struct counter_values *v, double n){
+  const double *count = v->count;
+
+  for(int i = 0; i < COUNTER_EVENTS; i++){
+    if(i == COUNTER_BRANCH_MISSES){
+      double ipc = count[COUNTER_INSTRUCTIONS]/count[COUNTER_CYCLES];
+      if(isnan(ipc)) fprintf(out, " %6s", "-");
+      else fprintf(out, " %6.2f", ipc);
+    }
+
+    if(isnan(count[i])) fprintf(out, " %*s", width(i), "-");
+    else fprintf(out, " %*.*f", width(i), i < COUNTER_BRANCH_MISSES ? 2 : 4,
+                 count[i]/n);
+  }
+}
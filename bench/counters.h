@@ -0,0 +1,83 @@
+/*
+
+  counters.h
+
+  Hardware performance counters for the benchmarks, through Linux's
+  perf_event_open, to show why a function got faster or slower and not only
+  that it did: cycles, instructions (and so IPC), branch misses, L1 data cache
+  misses and floating point assists (the microcode slow path subnormals take).
+
+    struct counters c;
+    counters_open(&c);
+    ...
+    counters_start(&c);
+    run();
+    counters_stop(&c, &values);
+    counters_print(stdout, &values, n);
+    ...
+    counters_close(&c);
+
+  Counting is for the calling thread only, in user mode. Whatever can't be
+  counted is left out: on other systems, when perf_event_paranoid or a
+  container forbids it, or for an event the processor doesn't have. Then the
+  values are NaN and print as "-", and the benchmarks fall back to timings
+  alone. FP assists have no generic event, the raw event is picked for the
+  Intel cores known to have one, or can be given as a hex raw event code in
+  the environment variable MATH_FP_ASSIST_EVENT.
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#ifndef COUNTERS_H
+#define COUNTERS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+enum counter_event {
+  COUNTER_CYCLES,
+  COUNTER_INSTRUCTIONS,
+  COUNTER_BRANCH_MISSES,
+  COUNTER_L1D_MISSES,
+  COUNTER_FP_ASSISTS,
+  COUNTER_EVENTS
+};
+
+struct counters {
+  int fd[COUNTER_EVENTS];         // -1 for events that couldn't be opened
+  uint64_t id[COUNTER_EVENTS];    // the kernel's ids, to match up group reads
+  int leader;                     // the group leader's fd, or -1 if none
+  int opened;                     // number of events counting
+};
+
+struct counter_values {
+  double count[COUNTER_EVENTS];   // NaN for events that weren't counted
+};
+
+
+/*
+
+  counters_open returns how many of the events could be opened, and prints
+  why to stderr the first time none can. The rest are safe to call either
+  way.
+
+*/
+int counters_open(struct counters *c);
+void counters_start(struct counters *c);
+void counters_stop(struct counters *c, struct counter_values *v);
+void counters_close(struct counters *c);
+
+
+/*
+
+  counters_print prints the values divided by n (the number of values
+  processed) on one line, with IPC, in the columns of counters_print_header
+
+*/
+void counters_print_header(FILE *out);
+void counters_print(FILE *out, const struct counter_values *v, double n);
+
+#endif
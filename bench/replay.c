@@ -0,0 +1,365 @@
+/*
+
+  replay.c
+
+  Replays a captured argument trace (see trace.h) through the library, and
+  reports how fast the scalar, batch and multi-threaded paths get through it.
+  Optionally checks the results of each path against a reference trace holding
+  the expected outputs, and/or writes this library's outputs as a trace. Where hardware
+  counters are available (see counters.h) the scalar and batch runs also
+  report what they cost per value in cycles, instructions and so on.
+
+    cc -O2 -Iinclude -Isrc bench/replay.c bench/trace.c bench/counters.c \
+       -lpthread -o replay
+    ./replay [-p passes] [-t threads] [-r reference] [-u ulps] [-w output] trace
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#include "counters.h"
+#include "trace.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "math/cos.c"
+#include "math/sin.c"
+#include "math/tan.c"
+#include "math/exp.c"
+#include "math/log.c"
+#include "math/sinpi.c"
+#include "math/cospi.c"
+#include "math/tanpi.c"
+#include "math/sincos_batch.c"
+#include "math/sinpi_batch.c"
+#include "math/math_flush_subnormals.c"
+
+
+/*
+
+  cos and sin have no batch form of their own, they come out of sincos_batch.
+  The other half of each block is thrown away.
+
+*/
+#define DISCARD_BLOCK 256
+
+static void cosBatch(const double *x, double *y, size_t n){
+  double discard[DISCARD_BLOCK];
+  for(size_t i = 0; i < n; i += DISCARD_BLOCK){
+    size_t count = n-i < DISCARD_BLOCK ? n-i : DISCARD_BLOCK;
+    sincos_batch(x+i, discard, y+i, count);
+  }
+}
+
+static void sinBatch(const double *x, double *y, size_t n){
+  double discard[DISCARD_BLOCK];
+  for(size_t i = 0; i < n; i += DISCARD_BLOCK){
+    size_t count = n-i < DISCARD_BLOCK ? n-i : DISCARD_BLOCK;
+    sincos_batch(x+i, y+i, discard, count);
+  }
+}
+
+
+/*
+
+  Everything a trace can name. Functions without a batch form are replayed
+  through a plain loop in the batch and parallel runs.
+
+*/
+struct replayFunction {
+  const char *name;
+  enum trace_type type;
+  double (*scalar)(double);
+  float (*scalarf)(float);
+  void (*batch)(const double *, double *, size_t);
+};
+
+static const struct replayFunction FUNCTIONS[] = {
+  { "cos",    TRACE_DOUBLE, cos,   NULL,   cosBatch },
+  { "sin",    TRACE_DOUBLE, sin,   NULL,   sinBatch },
+  { "tan",    TRACE_DOUBLE, tan,   NULL,   NULL },
+  { "exp",    TRACE_DOUBLE, exp,   NULL,   NULL },
+  { "log",    TRACE_DOUBLE, log,   NULL,   NULL },
+  { "sinpi",  TRACE_DOUBLE, sinpi, NULL,   sinpi_batch },
+  { "cospi",  TRACE_DOUBLE, cospi, NULL,   cospi_batch },
+  { "tanpi",  TRACE_DOUBLE, tanpi, NULL,   tanpi_batch },
+  { "sinpif", TRACE_FLOAT,  NULL,  sinpif, NULL },
+  { "cospif", TRACE_FLOAT,  NULL,  cospif, NULL },
+  { "tanpif", TRACE_FLOAT,  NULL,  tanpif, NULL },
+  { "cosf",   TRACE_FLOAT,  NULL,  cosf,   NULL },
+  { "sinf",   TRACE_FLOAT,  NULL,  sinf,   NULL },
+  { "tanf",   TRACE_FLOAT,  NULL,  tanf,   NULL },
+};
+
+
+/*
+
+  Runs f over n values from in to out, one call per value or through the batch
+  form. Values are read straight out of the mapped file.
+
+*/
+static void runScalar(const struct replayFunction *f, const void *in, void *out,
+                      size_t n){
+  if(f->type == TRACE_FLOAT){
+    const float *x = in;
+    float *y = out;
+    for(size_t i = 0; i < n; i++) y[i] = f->scalarf(x[i]);
+  }else{
+    const double *x = in;
+    double *y = out;
+    for(size_t i = 0; i < n; i++) y[i] = f->scalar(x[i]);
+  }
+}
+
+static void runBatch(const struct replayFunction *f, const void *in, void *out,
+                     size_t n){
+  if(f->batch){
+    f->batch(in, out, n);
+  }else{
+    runScalar(f, in, out, n);
+  }
+}
+
+
+static double now(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+
+/*
+
+  The multi-threaded run splits the trace into one contiguous slice per thread,
+  each going through the batch path
+
+*/
+struct slice {
+  const struct replayFunction *f;
+  const char *in;
+  char *out;
+  size_t n;
+};
+
+static void *runSlice(void *arg){
+  struct slice *s = arg;
+  runBatch(s->f, s->in, s->out, s->n);
+  return NULL;
+}
+
+static void runParallel(const struct replayFunction *f, const void *in,
+                        void *out, size_t n, int threads){
+  pthread_t tid[threads];
+  struct slice slices[threads];
+  size_t size = f->type == TRACE_FLOAT ? sizeof(float) : sizeof(double);
+
+  for(int t = 0; t < threads; t++){
+    size_t first = n*t/threads, last = n*(t+1)/threads;
+    slices[t] = (struct slice){ f, (const char *)in + first*size,
+                                (char *)out + first*size, last-first };
+    pthread_create(&tid[t], NULL, runSlice, &slices[t]);
+  }
+  for(int t = 0; t < threads; t++){
+    pthread_join(tid[t], NULL);
+  }
+}
+
+
+/*
+
+  Maps a value onto an integer scale where neighbouring values are one apart,
+  so that differences are distances in units in the last place
+
+*/
+static int64_t orderedBits(double x, enum trace_type type){
+  if(type == TRACE_FLOAT){
+    int32_t i = (int32_t)floatToBits((float)x);
+    return i < 0 ? INT32_MIN - (int64_t)i : i;
+  }
+  int64_t i = (int64_t)doubleToBits(x);
+  return i < 0 ? INT64_MIN - i : i;
+}
+
+static double valueAt(const void *values, size_t i, enum trace_type type){
+  return type == TRACE_FLOAT ? ((const float *)values)[i]
+                             : ((const double *)values)[i];
+}
+
+
+/*
+
+  Compares results with a reference trace. Returns the number of values
+  further than ulps apart. NaNs match any NaN.
+
+*/
+static size_t verify(const struct replayFunction *f, const void *in,
+                     const void *out, const struct trace_map *ref, size_t n,
+                     double ulps){
+  size_t bad = 0;
+  double worst = 0;
+  size_t worstAt = 0;
+
+  for(size_t i = 0; i < n; i++){
+    double got = valueAt(out, i, f->type);
+    double want = valueAt(ref->values, i, f->type);
+    if(got != got && want != want) continue;
+
+    double d;
+    if(got != got || want != want){
+      d = 1.0/0.0;
+    }else{
+      int64_t a = orderedBits(got, f->type), b = orderedBits(want, f->type);
+      d = a > b ? (double)((uint64_t)a - (uint64_t)b)
+                : (double)((uint64_t)b - (uint64_t)a);
+    }
+
+    if(d > worst){
+      worst = d;
+      worstAt = i;
+    }
+    bad += d > ulps;
+  }
+
+  printf("    verify: %zu of %zu beyond %g ulp, worst %g ulp", bad, n, ulps,
+         worst);
+  if(worst > 0){
+    printf(" at %s(%a) = %a, expected %a", f->name,
+           valueAt(in, worstAt, f->type), valueAt(out, worstAt, f->type),
+           valueAt(ref->values, worstAt, f->type));
+  }
+  printf("\n");
+  return bad;
+}
+
+
+static void usage(const char *argv0){
+  fprintf(stderr, "usage: %s [-p passes] [-t threads] [-r reference] "
+                  "[-u ulps] [-w output] trace\n", argv0);
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  int passes = 5;
+  int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  const char *refPath = NULL, *outPath = NULL;
+  double ulps = 1;
+
+  int opt;
+  while((opt = getopt(argc, argv, "p:t:r:u:w:")) != -1){
+    switch(opt){
+      case 'p': passes = atoi(optarg); break;
+      case 't': threads = atoi(optarg); break;
+      case 'r': refPath = optarg; break;
+      case 'u': ulps = atof(optarg); break;
+      case 'w': outPath = optarg; break;
+      default: usage(argv[0]);
+    }
+  }
+  if(optind != argc-1 || passes < 1 || threads < 1) usage(argv[0]);
+
+  struct trace_map trace;
+  if(trace_map(argv[optind], &trace) != 0) return 1;
+
+  const struct replayFunction *f = NULL;
+  for(size_t i = 0; i < sizeof(FUNCTIONS)/sizeof(FUNCTIONS[0]); i++){
+    if(!strcmp(FUNCTIONS[i].name, trace.header->function)){
+      f = &FUNCTIONS[i];
+    }
+  }
+  if(!f){
+    fprintf(stderr, "%s: this library has no function \"%s\" to replay\n",
+            argv[optind], trace.header->function);
+    return 1;
+  }
+  if(f->type != trace.header->type){
+    fprintf(stderr, "%s: %s takes %s arguments\n", argv[optind], f->name,
+            f->type == TRACE_FLOAT ? "float" : "double");
+    return 1;
+  }
+
+  size_t n = trace.header->count;
+  size_t size = f->type == TRACE_FLOAT ? sizeof(float) : sizeof(double);
+  void *out = aligned_alloc(64, (n*size + 63) & ~(size_t)63);
+  if(!out && n){
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  struct trace_map ref;
+  if(refPath){
+    if(trace_map(refPath, &ref) != 0) return 1;
+    if(ref.header->type != f->type || ref.header->count < n){
+      fprintf(stderr, "%s: reference doesn't match the trace\n", refPath);
+      return 1;
+    }
+  }
+
+  printf("%s: %zu %s arguments, best of %d passes\n", f->name, n,
+         f->type == TRACE_FLOAT ? "float" : "double", passes);
+
+  /*
+    Counters count the calling thread only, so the parallel run gets timed
+    but not counted. The counts shown are those of the fastest pass.
+  */
+  struct counters counters;
+  int counting = counters_open(&counters) > 0;
+
+  printf("  %-13s %8s", "", "ns/value");
+  if(counting) counters_print_header(stdout);
+  printf("\n");
+
+  /*
+    All three paths write the same buffer, so each is checked against the
+    reference as soon as it has run, before the next one overwrites it.
+  */
+  int status = 0;
+  const char *names[3] = { "scalar", f->batch ? "batch" : "batch (loop)",
+                           "parallel" };
+  for(int path = 0; path < 3; path++){
+    double best = 1.0/0.0;
+    struct counter_values bestCounts, counts;
+    for(int p = 0; p < passes; p++){
+      double start = now();
+      counters_start(&counters);
+      if(path == 0) runScalar(f, trace.values, out, n);
+      else if(path == 1) runBatch(f, trace.values, out, n);
+      else runParallel(f, trace.values, out, n, threads);
+      counters_stop(&counters, &counts);
+      double t = now() - start;
+      if(t < best){
+        best = t;
+        bestCounts = counts;
+      }
+    }
+    printf("  %-13s %8.3f", names[path], n ? best*1e9/n : 0.0);
+    if(path == 2) printf("  (%d threads)", threads);
+    else if(counting) counters_print(stdout, &bestCounts, n ? n : 1);
+    printf("\n");
+
+    if(refPath && verify(f, trace.values, out, &ref, n, ulps)) status = 1;
+  }
+  counters_close(&counters);
+  if(refPath) trace_unmap(&ref);
+
+  if(outPath){
+    struct trace_writer *w = trace_open(outPath, f->name, f->type);
+    if(!w){
+      perror(outPath);
+      return 1;
+    }
+    trace_record_array(w, out, n);
+    if(trace_close(w) != 0){
+      fprintf(stderr, "%s: write failed\n", outPath);
+      return 1;
+    }
+  }
+
+  free(out);
+  trace_unmap(&trace);
+  return status;
+}
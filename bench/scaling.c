@@ -0,0 +1,288 @@
+/*
+
+  scaling.c
+
+  Checks that the math functions scale across threads: that each thread gets
+  as much done running alongside others as it does alone. Anything the
+  threads shared and wrote (a global errno, a lazily built table, a counter,
+  a table on a cache line with something written) would show up here as
+  per-thread throughput falling as threads are added.
+
+  Every function is run on 1, 2, 4, ... up to the thread count, each thread
+  on its own array of arguments, once with the threads left to the scheduler
+  and once pinned one to a CPU. Per-thread throughput is reported with its
+  ratio to the single thread's. The pinned ratios are the guarantee: any
+  below the minimum efficiency are marked, and the program exits with status
+  1, so it can be run as a test.
+
+    cc -O2 -Iinclude -Isrc bench/scaling.c -lpthread -o scaling
+    ./scaling [-t threads] [-n count] [-p passes] [-e efficiency]
+
+  Threads sharing a core through SMT compete for its execution units and
+  will fall short for that reason alone, so on such machines the thread
+  count should be at most the number of physical cores.
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "math/cos.c"
+#include "math/sin.c"
+#include "math/tan.c"
+#include "math/sincos_batch.c"
+#include "math/sinpi_batch.c"
+#include "math/half_batch.c"
+#include "math/math_flush_subnormals.c"
+
+
+static void cosLoop(const double *x, double *y, double *z, size_t n){
+  (void)z;
+  for(size_t i = 0; i < n; i++) y[i] = cos(x[i]);
+}
+
+static void sinLoop(const double *x, double *y, double *z, size_t n){
+  (void)z;
+  for(size_t i = 0; i < n; i++) y[i] = sin(x[i]);
+}
+
+static void tanLoop(const double *x, double *y, double *z, size_t n){
+  (void)z;
+  for(size_t i = 0; i < n; i++) y[i] = tan(x[i]);
+}
+
+static void sincosBatch(const double *x, double *y, double *z, size_t n){
+  sincos_batch(x, y, z, n);
+}
+
+static void sinpiBatch(const double *x, double *y, double *z, size_t n){
+  (void)z;
+  sinpi_batch(x, y, n);
+}
+
+// The half arguments are the doubles' bits read as n halves, NaNs and all
+static void cosHalfBatch(const double *x, double *y, double *z, size_t n){
+  (void)z;
+  cos_f16_batch((const uint16_t *)x, (uint16_t *)y, n);
+}
+
+
+struct scalingFunction {
+  const char *name;
+  void (*run)(const double *x, double *y, double *z, size_t n);
+};
+
+static const struct scalingFunction FUNCTIONS[] = {
+  { "cos",           cosLoop },
+  { "sin",           sinLoop },
+  { "tan",           tanLoop },
+  { "sincos_batch",  sincosBatch },
+  { "sinpi_batch",   sinpiBatch },
+  { "cos_f16_batch", cosHalfBatch },
+};
+
+#define FUNCTION_COUNT (int)(sizeof(FUNCTIONS)/sizeof(FUNCTIONS[0]))
+
+
+static double now(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+
+/*
+
+  One thread of a run. Each allocates and fills its own arrays, so that they
+  are local to the thread's memory and share no cache lines with another's,
+  then waits for the rest before starting the clock.
+
+*/
+struct worker {
+  const struct scalingFunction *f;
+  pthread_barrier_t *start;
+  size_t n;
+  int passes;
+  int cpu;          // CPU to pin to, or -1
+  double seconds;   // time taken, set by the thread
+  int failed;       // nonzero if pinning or allocating failed
+} __attribute__((aligned(64)));
+
+static void *runWorker(void *arg){
+  struct worker *w = arg;
+
+  if(w->cpu >= 0){
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    w->failed = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+
+  size_t bytes = (w->n*sizeof(double) + 63) & ~(size_t)63;
+  double *x = aligned_alloc(64, bytes);
+  double *y = aligned_alloc(64, bytes);
+  double *z = aligned_alloc(64, bytes);
+  if(!x || !y || !z){
+    w->failed = 1;
+    pthread_barrier_wait(w->start);
+    return NULL;
+  }
+
+  // Arguments spread over a few turns, so the medium reduction is exercised
+  uint64_t state = 0x9e3779b97f4a7c15 ^ (uint64_t)(w->cpu + 2);
+  for(size_t i = 0; i < w->n; i++){
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    x[i] = (double)(state >> 11) * 0x1p-53 * 40 - 20;
+  }
+  w->f->run(x, y, z, w->n);
+
+  pthread_barrier_wait(w->start);
+  double begin = now();
+  for(int p = 0; p < w->passes; p++) w->f->run(x, y, z, w->n);
+  w->seconds = now() - begin;
+
+  free(x);
+  free(y);
+  free(z);
+  return NULL;
+}
+
+
+/*
+
+  Runs f on threads threads at once and returns the average throughput per
+  thread in millions of values a second, or a negative number if pinning or
+  allocating failed. cpus[] lists the CPUs to pin to, or is NULL. Each
+  measurement is the best of RUNS, to keep the noise out of the ratios.
+
+*/
+#define RUNS 3
+
+static double runOnce(const struct scalingFunction *f, int threads,
+                      const int *cpus, size_t n, int passes){
+  pthread_t tid[threads];
+  struct worker *workers = aligned_alloc(64, threads*sizeof(struct worker));
+  pthread_barrier_t start;
+  if(!workers) return -1;
+
+  pthread_barrier_init(&start, NULL, threads);
+  for(int t = 0; t < threads; t++){
+    workers[t] = (struct worker){ f, &start, n, passes, cpus ? cpus[t] : -1,
+                                  0, 0 };
+    pthread_create(&tid[t], NULL, runWorker, &workers[t]);
+  }
+
+  double total = 0;
+  int failed = 0;
+  for(int t = 0; t < threads; t++){
+    pthread_join(tid[t], NULL);
+    failed |= workers[t].failed;
+    total += n*(double)passes/workers[t].seconds;
+  }
+  pthread_barrier_destroy(&start);
+  free(workers);
+
+  return failed ? -1 : total/threads*1e-6;
+}
+
+static double runThreads(const struct scalingFunction *f, int threads,
+                         const int *cpus, size_t n, int passes){
+  double best = 0;
+  for(int r = 0; r < RUNS; r++){
+    double rate = runOnce(f, threads, cpus, n, passes);
+    if(rate < 0) return rate;
+    if(rate > best) best = rate;
+  }
+  return best;
+}
+
+
+static void usage(const char *argv0){
+  fprintf(stderr, "usage: %s [-t threads] [-n count] [-p passes] "
+                  "[-e efficiency]\n", argv0);
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  cpu_set_t allowed;
+  int cpus[CPU_SETSIZE], cpuCount = 0;
+  sched_getaffinity(0, sizeof(allowed), &allowed);
+  for(int c = 0; c < CPU_SETSIZE; c++){
+    if(CPU_ISSET(c, &allowed)) cpus[cpuCount++] = c;
+  }
+
+  int maxThreads = cpuCount;
+  size_t n = 1 << 14;
+  int passes = 20;
+  double minimum = 0.9;
+
+  int opt;
+  while((opt = getopt(argc, argv, "t:n:p:e:")) != -1){
+    switch(opt){
+      case 't': maxThreads = atoi(optarg); break;
+      case 'n': n = strtoul(optarg, NULL, 10); break;
+      case 'p': passes = atoi(optarg); break;
+      case 'e': minimum = atof(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if(optind != argc || maxThreads < 1 || n == 0 || passes < 1) usage(argv[0]);
+  if(maxThreads > cpuCount){
+    fprintf(stderr, "only %d CPUs to pin %d threads to\n", cpuCount,
+            maxThreads);
+    return 2;
+  }
+
+  printf("Mvalues/s per thread (and relative to one thread), %zu values, "
+         "%d passes\n\n", n, passes);
+  printf("%-14s %7s %18s %18s\n", "function", "threads", "unpinned",
+         "pinned");
+
+  int failures = 0;
+  for(int i = 0; i < FUNCTION_COUNT; i++){
+    const struct scalingFunction *f = &FUNCTIONS[i];
+    double base[2] = { 0, 0 };
+
+    for(int threads = 1; ; threads = threads*2 < maxThreads ? threads*2
+                                                             : maxThreads){
+      int below = 0;
+      printf("%-14s %7d", f->name, threads);
+
+      for(int pinned = 0; pinned < 2; pinned++){
+        double rate = runThreads(f, threads, pinned ? cpus : NULL, n, passes);
+        if(rate < 0){
+          fprintf(stderr, "\n%s: couldn't start %d threads\n", f->name,
+                  threads);
+          return 1;
+        }
+        if(threads == 1) base[pinned] = rate;
+
+        double efficiency = rate/base[pinned];
+        printf(" %10.2f (%4.2f)", rate, efficiency);
+        below |= pinned && efficiency < minimum;
+      }
+      printf("%s\n", below ? "  below minimum" : "");
+      failures += below;
+
+      if(threads == maxThreads) break;
+    }
+  }
+
+  if(failures){
+    printf("\n%d pinned runs below %.2f of single thread throughput\n",
+           failures, minimum);
+    return 1;
+  }
+  return 0;
+}
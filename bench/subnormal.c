@@ -0,0 +1,176 @@
+/*
+
+  subnormal.c
+
+  Shows what subnormal arguments cost, and what math_flush_subnormals saves.
+
+  Runs sin and the batch functions over arrays of ordinary arguments, of
+  subnormal arguments, of a mix, and of tiny arguments whose squares are
+  subnormal, with flushing off and on.
+
+    cc -O2 -Iinclude -Isrc bench/subnormal.c bench/counters.c -o subnormal
+    ./subnormal [count]
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "counters.h"
+#include "math/sin.c"
+#include "math/sincos_batch.c"
+#include "math/sinpi_batch.c"
+#include "math/math_flush_subnormals.c"
+
+
+#define PASSES 5
+
+static uint64_t state = 0x9e3779b97f4a7c15;
+
+static uint64_t nextRandom(void){
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Uniform in [0,1)
+static double uniform(void){
+  return (nextRandom() >> 11) * 0x1p-53;
+}
+
+// A random subnormal double of either sign
+static double subnormal(void){
+  uint64_t bits = nextRandom() & 0x800fffffffffffff;
+  return bitsToDouble(bits | 1);
+}
+
+
+static double now(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+
+enum run { RUN_SIN, RUN_SINCOS_BATCH, RUN_SINPI_BATCH };
+
+/*
+
+  Best time over PASSES of one run, in nanoseconds per value, with the
+  counters' values for that pass
+
+*/
+static double timeRun(enum run run, const double *x, double *a, double *b,
+                      size_t n, struct counters *c,
+                      struct counter_values *values){
+  double best = 1.0/0.0;
+  struct counter_values counts;
+
+  for(int p = 0; p < PASSES; p++){
+    double start = now();
+    counters_start(c);
+    switch(run){
+      case RUN_SIN:
+        for(size_t i = 0; i < n; i++) a[i] = sin(x[i]);
+        break;
+      case RUN_SINCOS_BATCH:
+        sincos_batch(x, a, b, n);
+        break;
+      case RUN_SINPI_BATCH:
+        sinpi_batch(x, a, n);
+        break;
+    }
+    counters_stop(c, &counts);
+    double t = now() - start;
+    if(t < best){
+      best = t;
+      *values = counts;
+    }
+  }
+
+  return best*1e9/n;
+}
+
+
+int main(int argc, char **argv){
+  size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1 << 20;
+  if(n == 0){
+    fprintf(stderr, "usage: %s [count]\n", argv[0]);
+    return 2;
+  }
+
+  double *x = malloc(n*sizeof(double));
+  double *a = malloc(n*sizeof(double));
+  double *b = malloc(n*sizeof(double));
+  if(!x || !a || !b){
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  const char *sets[] = { "normal", "subnormal", "half subnormal", "tiny" };
+  const char *runs[] = { "sin", "sincos_batch", "sinpi_batch" };
+
+  struct counters counters;
+  int counting = counters_open(&counters) > 0;
+  struct counter_values counts[4][3][2];
+
+  printf("ns per value, best of %d passes over %zu values\n\n", PASSES, n);
+  printf("%-16s %-14s %10s %10s\n", "arguments", "function", "exact",
+         "flushed");
+
+  for(int set = 0; set < 4; set++){
+    for(size_t i = 0; i < n; i++){
+      switch(set){
+        case 0: x[i] = 20*uniform() - 10; break;
+        case 1: x[i] = subnormal(); break;
+        case 2:
+          x[i] = nextRandom() & 1 ? subnormal() : 20*uniform() - 10;
+          break;
+
+        // Normal, but x*x and the polynomial terms underflow
+        default: x[i] = (1 + uniform()) * 0x1p-520; break;
+      }
+    }
+
+    for(int run = 0; run < 3; run++){
+      math_flush_subnormals(0);
+      double exact = timeRun(run, x, a, b, n, &counters, &counts[set][run][0]);
+      math_flush_subnormals(1);
+      double flushed = timeRun(run, x, a, b, n, &counters,
+                               &counts[set][run][1]);
+      math_flush_subnormals(0);
+
+      printf("%-16s %-14s %10.2f %10.2f\n", sets[set], runs[run], exact,
+             flushed);
+    }
+  }
+
+  if(counting){
+    printf("\nper value, in the fastest pass\n\n");
+    printf("%-16s %-14s %-8s", "arguments", "function", "mode");
+    counters_print_header(stdout);
+    printf("\n");
+
+    for(int set = 0; set < 4; set++){
+      for(int run = 0; run < 3; run++){
+        for(int flush = 0; flush < 2; flush++){
+          printf("%-16s %-14s %-8s", sets[set], runs[run],
+                 flush ? "flushed" : "exact");
+          counters_print(stdout, &counts[set][run][flush], n);
+          printf("\n");
+        }
+      }
+    }
+  }
+  counters_close(&counters);
+
+  free(x);
+  free(a);
+  free(b);
+  return 0;
+}
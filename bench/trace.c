@@ -0,0 +1,152 @@
+/*
+
+  trace.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#include "trace.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+struct trace_writer {
+  FILE *file;
+  struct trace_header header;
+};
+
+
+/*
+
+  Creates the file and writes a header with a count of zero, which is filled in
+  when the writer is closed
+
+*/
+struct trace_writer *trace_open(const char *path, const char *function,
+                                enum trace_type type){
+  struct trace_writer *w = calloc(1, sizeof(*w));
+  if(!w) return NULL;
+
+  w->file = fopen(path, "wb");
+  if(!w->file){
+    free(w);
+    return NULL;
+  }
+
+  memcpy(w->header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+  strncpy(w->header.function, function, sizeof(w->header.function)-1);
+  w->header.type = type;
+
+  fwrite(&w->header, sizeof(w->header), 1, w->file);
+  return w;
+}
+
+
+/*
+
+  Appends one value, converted to the type of the trace
+
+*/
+void trace_record(struct trace_writer *w, double value){
+  if(w->header.type == TRACE_FLOAT){
+    float f = (float)value;
+    fwrite(&f, sizeof(f), 1, w->file);
+  }else{
+    fwrite(&value, sizeof(value), 1, w->file);
+  }
+  w->header.count++;
+}
+
+
+/*
+
+  Appends n values, which must already be of the type of the trace
+
+*/
+void trace_record_array(struct trace_writer *w, const void *values, size_t n){
+  size_t size = w->header.type == TRACE_FLOAT ? sizeof(float) : sizeof(double);
+  fwrite(values, size, n, w->file);
+  w->header.count += n;
+}
+
+
+/*
+
+  Fills in the count and closes the file. Returns 0, or -1 if anything along
+  the way failed to write.
+
+*/
+int trace_close(struct trace_writer *w){
+  int failed = ferror(w->file);
+
+  if(fseek(w->file, 0, SEEK_SET) == 0){
+    failed |= fwrite(&w->header, sizeof(w->header), 1, w->file) != 1;
+  }else{
+    failed = 1;
+  }
+  failed |= fclose(w->file) != 0;
+
+  free(w);
+  return failed ? -1 : 0;
+}
+
+
+/*
+
+  Maps a trace and checks that its header makes sense and that the file really
+  holds count values. Returns 0, or -1 with a message on stderr.
+
+*/
+int trace_map(const char *path, struct trace_map *map){
+  int fd = open(path, O_RDONLY);
+  if(fd < 0){
+    perror(path);
+    return -1;
+  }
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(struct trace_header)){
+    fprintf(stderr, "%s: not a trace file\n", path);
+    close(fd);
+    return -1;
+  }
+
+  void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(p == MAP_FAILED){
+    perror(path);
+    return -1;
+  }
+
+  map->header = p;
+  map->values = (const char *)p + sizeof(struct trace_header);
+  map->size = st.st_size;
+
+  const struct trace_header *h = map->header;
+  size_t size = h->type == TRACE_FLOAT ? sizeof(float) : sizeof(double);
+  if(memcmp(h->magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0
+     || (h->type != TRACE_DOUBLE && h->type != TRACE_FLOAT)
+     || h->function[sizeof(h->function)-1] != 0
+     || h->count > (map->size - sizeof(*h)) / size){
+    fprintf(stderr, "%s: bad trace header\n", path);
+    trace_unmap(map);
+    return -1;
+  }
+
+  // Replay streams through the data once per pass
+  madvise(p, st.st_size, MADV_SEQUENTIAL);
+  return 0;
+}
+
+void trace_unmap(struct trace_map *map){
+  munmap((void *)map->header, map->size);
+  map->header = NULL;
+}
@@ -0,0 +1,84 @@
+/*
+
+  trace.h
+
+  Argument trace files: arrays of arguments captured from a real program, to
+  benchmark the library on real inputs instead of made up ones.
+
+  A trace is a 64 byte header followed directly by count doubles or floats in
+  native byte order. The header being 64 bytes keeps the data aligned for
+  vector loads when the file is memory mapped.
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+#define TRACE_MAGIC "MTRACE1"
+
+enum trace_type {
+  TRACE_DOUBLE = 1,
+  TRACE_FLOAT = 2
+};
+
+struct trace_header {
+  char magic[8];          // TRACE_MAGIC, NUL terminated
+  char function[24];      // name of the function the values belong to
+  uint32_t type;          // enum trace_type
+  uint32_t reserved;
+  uint64_t count;         // number of values after the header
+  uint8_t padding[16];
+};
+
+_Static_assert(sizeof(struct trace_header) == 64, "trace header must be 64 bytes");
+
+
+/*
+
+  Capturing. Add trace_record calls next to the calls to be captured:
+
+    struct trace_writer *w = trace_open("cos.trace", "cos", TRACE_DOUBLE);
+    ...
+    trace_record(w, x);
+    y = cos(x);
+    ...
+    trace_close(w);
+
+  Values are buffered and the count in the header is filled in by trace_close.
+  A writer must not be shared between threads without a lock, give each thread
+  its own file instead.
+
+*/
+struct trace_writer;
+
+struct trace_writer *trace_open(const char *path, const char *function,
+                                enum trace_type type);
+void trace_record(struct trace_writer *w, double value);
+void trace_record_array(struct trace_writer *w, const void *values, size_t n);
+int trace_close(struct trace_writer *w);
+
+
+/*
+
+  Reading. trace_map maps a whole trace into memory read-only and checks its
+  header. The values are used straight from the mapping, nothing is copied.
+
+*/
+struct trace_map {
+  const struct trace_header *header;
+  const void *values;
+  size_t size;
+};
+
+int trace_map(const char *path, struct trace_map *map);
+void trace_unmap(struct trace_map *map);
+
+#endif
@@ -0,0 +1,402 @@
+/*
+
+  complex.h as defined by C17 ISO/IEC 9899:2017
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_H
+#define COMPLEX_H
+
+/*
+
+  Expands to _Complex
+
+*/
+#define complex _Complex
+
+/*
+
+  Expands to a constant expression of type const float _Complex, with the value
+  of the imaginary unit
+
+*/
+#define _Complex_I (__extension__ 1.0iF)
+
+/*
+
+  Imaginary types are optional (Annex G) and not supported, so I is
+  _Complex_I
+
+*/
+#define I _Complex_I
+
+/*
+
+  Expand to an expression of the complex type with real part x and imaginary
+  part y, even when either is an infinity or a NaN (where x + I*y would come
+  out as NaN + iNaN)
+
+*/
+#if defined(__GNUC__) || defined(__clang__)
+  #define CMPLX(x, y) __builtin_complex((double)(x), (double)(y))
+  #define CMPLXF(x, y) __builtin_complex((float)(x), (float)(y))
+  #define CMPLXL(x, y) __builtin_complex((long double)(x), (long double)(y))
+#else
+  #define CMPLX(x, y) ((double complex)((double)(x) + I*(double)(y)))
+  #define CMPLXF(x, y) ((float complex)((float)(x) + I*(float)(y)))
+  #define CMPLXL(x, y) ((long double complex)((long double)(x) + \
+                                              I*(long double)(y)))
+#endif
+
+/*
+
+  Can be used to inform the implementation that the usual mathematical formulas
+  for multiplication, division and absolute value are acceptable
+
+*/
+#pragma STDC CX_LIMITED_RANGE OFF
+
+/*
+
+  None of the functions below set errno, so their results depend on nothing
+  but their arguments, and they are declared const like math.h's functions
+  in MATH_NO_ERRNO builds (and likewise not in MATH_STATS builds)
+
+*/
+#if defined(__GNUC__) && !defined(MATH_STATS)
+  #define __COMPLEX_CONST __attribute__((const))
+#else
+  #define __COMPLEX_CONST
+#endif
+
+
+/*
+
+  Compute the complex arc cosine of z, with branch cuts outside the interval
+  [-1,+1] along the real axis
+
+  Returns the complex arc cosine value, in the range of a strip mathematically
+  unbounded along the imaginary axis and in the interval [0,pi] along the real
+  axis
+
+*/
+double complex cacos(double complex z) __COMPLEX_CONST;
+float complex cacosf(float complex z) __COMPLEX_CONST;
+long double complex cacosl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex arc sine of z, with branch cuts outside the interval
+  [-1,+1] along the real axis
+
+  Returns the complex arc sine value, in the range of a strip mathematically
+  unbounded along the imaginary axis and in the interval [-pi/2,+pi/2] along
+  the real axis
+
+*/
+double complex casin(double complex z) __COMPLEX_CONST;
+float complex casinf(float complex z) __COMPLEX_CONST;
+long double complex casinl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex arc tangent of z, with branch cuts outside the interval
+  [-i,+i] along the imaginary axis
+
+  Returns the complex arc tangent value, in the range of a strip mathematically
+  unbounded along the imaginary axis and in the interval [-pi/2,+pi/2] along
+  the real axis
+
+*/
+double complex catan(double complex z) __COMPLEX_CONST;
+float complex catanf(float complex z) __COMPLEX_CONST;
+long double complex catanl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex cosine of z
+
+  Returns the complex cosine value
+
+*/
+double complex ccos(double complex z) __COMPLEX_CONST;
+float complex ccosf(float complex z) __COMPLEX_CONST;
+long double complex ccosl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex sine of z
+
+  Returns the complex sine value
+
+*/
+double complex csin(double complex z) __COMPLEX_CONST;
+float complex csinf(float complex z) __COMPLEX_CONST;
+long double complex csinl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex tangent of z
+
+  Returns the complex tangent value
+
+*/
+double complex ctan(double complex z) __COMPLEX_CONST;
+float complex ctanf(float complex z) __COMPLEX_CONST;
+long double complex ctanl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex arc hyperbolic cosine of z, with a branch cut at values
+  less than 1 along the real axis
+
+  Returns the complex arc hyperbolic cosine value, in the range of a half-strip
+  of nonnegative values along the real axis and in the interval [-i*pi,+i*pi]
+  along the imaginary axis
+
+*/
+double complex cacosh(double complex z) __COMPLEX_CONST;
+float complex cacoshf(float complex z) __COMPLEX_CONST;
+long double complex cacoshl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex arc hyperbolic sine of z, with branch cuts outside the
+  interval [-i,+i] along the imaginary axis
+
+  Returns the complex arc hyperbolic sine value, in the range of a strip
+  mathematically unbounded along the real axis and in the interval
+  [-i*pi/2,+i*pi/2] along the imaginary axis
+
+*/
+double complex casinh(double complex z) __COMPLEX_CONST;
+float complex casinhf(float complex z) __COMPLEX_CONST;
+long double complex casinhl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex arc hyperbolic tangent of z, with branch cuts outside the
+  interval [-1,+1] along the real axis
+
+  Returns the complex arc hyperbolic tangent value, in the range of a strip
+  mathematically unbounded along the real axis and in the interval
+  [-i*pi/2,+i*pi/2] along the imaginary axis
+
+*/
+double complex catanh(double complex z) __COMPLEX_CONST;
+float complex catanhf(float complex z) __COMPLEX_CONST;
+long double complex catanhl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex hyperbolic cosine of z
+
+  Returns the complex hyperbolic cosine value
+
+*/
+double complex ccosh(double complex z) __COMPLEX_CONST;
+float complex ccoshf(float complex z) __COMPLEX_CONST;
+long double complex ccoshl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex hyperbolic sine of z
+
+  Returns the complex hyperbolic sine value
+
+*/
+double complex csinh(double complex z) __COMPLEX_CONST;
+float complex csinhf(float complex z) __COMPLEX_CONST;
+long double complex csinhl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex hyperbolic tangent of z
+
+  Returns the complex hyperbolic tangent value
+
+*/
+double complex ctanh(double complex z) __COMPLEX_CONST;
+float complex ctanhf(float complex z) __COMPLEX_CONST;
+long double complex ctanhl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex base-e exponential of z
+
+  Returns the complex base-e exponential value
+
+*/
+double complex cexp(double complex z) __COMPLEX_CONST;
+float complex cexpf(float complex z) __COMPLEX_CONST;
+long double complex cexpl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex natural (base-e) logarithm of z, with a branch cut along
+  the negative real axis
+
+  Returns the complex natural logarithm value, in the range of a strip
+  mathematically unbounded along the real axis and in the interval
+  [-i*pi,+i*pi] along the imaginary axis
+
+*/
+double complex clog(double complex z) __COMPLEX_CONST;
+float complex clogf(float complex z) __COMPLEX_CONST;
+long double complex clogl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex absolute value (also called norm, modulus, or
+  magnitude) of z
+
+  Returns the complex absolute value
+
+*/
+double cabs(double complex z) __COMPLEX_CONST;
+float cabsf(float complex z) __COMPLEX_CONST;
+long double cabsl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex power function x^y, with a branch cut for the first
+  parameter along the negative real axis
+
+  Returns the complex power function value
+
+*/
+double complex cpow(double complex x, double complex y) __COMPLEX_CONST;
+float complex cpowf(float complex x, float complex y) __COMPLEX_CONST;
+long double complex cpowl(long double complex x, long double complex y)
+  __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex square root of z, with a branch cut along the negative
+  real axis
+
+  Returns the complex square root value, in the range of the right half-plane
+  (including the imaginary axis)
+
+*/
+double complex csqrt(double complex z) __COMPLEX_CONST;
+float complex csqrtf(float complex z) __COMPLEX_CONST;
+long double complex csqrtl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the argument (also called phase angle) of z, with a branch cut along
+  the negative real axis
+
+  Returns the value of the argument in the interval [-pi,+pi]
+
+*/
+double carg(double complex z) __COMPLEX_CONST;
+float cargf(float complex z) __COMPLEX_CONST;
+long double cargl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the imaginary part of z
+
+  Returns the imaginary part value (as a real)
+
+*/
+double cimag(double complex z) __COMPLEX_CONST;
+float cimagf(float complex z) __COMPLEX_CONST;
+long double cimagl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the complex conjugate of z, by reversing the sign of its imaginary
+  part
+
+  Returns the complex conjugate value
+
+*/
+double complex conj(double complex z) __COMPLEX_CONST;
+float complex conjf(float complex z) __COMPLEX_CONST;
+long double complex conjl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute a projection of z onto the Riemann sphere: z projects to z except
+  that all complex infinities (even those with one infinite part and one NaN
+  part) project to positive infinity on the real axis
+
+  Returns the value of the projection onto the Riemann sphere
+
+*/
+double complex cproj(double complex z) __COMPLEX_CONST;
+float complex cprojf(float complex z) __COMPLEX_CONST;
+long double complex cprojl(long double complex z) __COMPLEX_CONST;
+
+
+/*
+
+  Compute the real part of z
+
+  Returns the real part value
+
+*/
+double creal(double complex z) __COMPLEX_CONST;
+float crealf(float complex z) __COMPLEX_CONST;
+long double creall(long double complex z) __COMPLEX_CONST;
+
+
+
+/*
+
+  Everything below is not part of C17. These are extensions for code that
+  works on whole arrays of arguments at once.
+
+*/
+#include <stddef.h>
+
+
+/*
+
+  Compute w[i] = cexp(z[i]), csin(z[i]), ccos(z[i]) and clog(z[i]), and
+  r[i] = cabs(z[i]) and carg(z[i]), for i in [0,n). The complex outputs may be
+  the same array as z.
+
+  The arrays are read and written as interleaved (real, imaginary) pairs, which
+  is the layout of an array of double complex, such as an FFT's output. A block
+  at a time is split into its real and imaginary parts, so the parts can be
+  worked on a vector at a time, with the sines and cosines from the same fused
+  kernel as sincos_batch. Infinite and NaN parts are handled separately
+  afterwards, one at a time. Flushing of subnormals (math_flush_subnormals)
+  applies to these as to math.h's batch functions.
+
+*/
+void cexp_batch(const double complex *z, double complex *w, size_t n);
+void csin_batch(const double complex *z, double complex *w, size_t n);
+void ccos_batch(const double complex *z, double complex *w, size_t n);
+void clog_batch(const double complex *z, double complex *w, size_t n);
+void cabs_batch(const double complex *z, double *r, size_t n);
+void carg_batch(const double complex *z, double *r, size_t n);
+
+#endif
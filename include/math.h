@@ -7,6 +7,9 @@
 
 */
 
+#ifndef MATH_H
+#define MATH_H
+
 #if FLT_EVAL_METHOD == 0
 
   typedef float float_t;
@@ -35,15 +38,15 @@
   as a float
 
 */
-#define HUGE_VAL
+#define HUGE_VAL (__builtin_huge_val())
 
 /*
 
   Respectively float and long double analogs of HUGE_VAL
 
 */
-#define HUGE_VALF
-#define HUGE_VALL
+#define HUGE_VALF (__builtin_huge_valf())
+#define HUGE_VALL (__builtin_huge_vall())
 
 /*
 
@@ -52,7 +55,7 @@
   that overflows at translation time
 
 */
-#define INFINITY
+#define INFINITY (__builtin_inff())
 
 /*
 
@@ -60,8 +63,8 @@
   constant expression of type float representing a quiet NaN
 
 */
-#if
-  #define NAN
+#ifdef __FLT_HAS_QUIET_NAN__
+  #define NAN (__builtin_nanf(""))
 #endif
 
 
@@ -71,19 +74,25 @@
   Expand to integer constant expressions with distinct values.
 
 */
-#define FP_INFINITE
-#define FP_NAN
-#define FP_NORMAL
-#define FP_SUBNORMAL
-#define FP_ZERO
+#define FP_NAN 0
+#define FP_INFINITE 1
+#define FP_ZERO 2
+#define FP_SUBNORMAL 3
+#define FP_NORMAL 4
 
 /*
 
   If FP_FAST_FMA is defined, it indicates that the fma function generally
   executes as fast, or faster than, a multiply and an add of double operands.
 
+  That is only true when the target has a fused multiply-add instruction, which
+  the compiler tells us about (__FP_FAST_FMA from GCC, __FMA__ for x86 builds
+  with -mfma or a -march that includes it).
+
 */
-//#define FP_FAST_FMA
+#if defined(__FP_FAST_FMA) || defined(__FMA__)
+  #define FP_FAST_FMA 1
+#endif
 
 
 /*
@@ -91,8 +100,12 @@
   float and long double analogs of FP_FAST_FMA, if defined, expand to 1
 
 */
-//#define FP_FAST_FMAF
-//#define FP_FAST_FMAL
+#if defined(__FP_FAST_FMAF) || defined(__FMA__)
+  #define FP_FAST_FMAF 1
+#endif
+#if defined(__FP_FAST_FMAL)
+  #define FP_FAST_FMAL 1
+#endif
 
 /*
 
@@ -104,6 +117,8 @@
   The value of FP_ILOGBNAN shall be either INT_MAX or INT_MIN.
 
 */
+#include <limits.h>
+
 #define FP_ILOGB0 INT_MIN
 #define FP_ILOGBNAN INT_MAX
 
@@ -111,7 +126,57 @@
 #define MATH_ERRNO 1
 #define MATH_ERREXCEPT 2
 
-#define math_errhandling MATH_ERRNO | MATH_ERREXCEPT
+/*
+
+  Functions report errors by setting errno and raising floating-point
+  exceptions, unless the library and its callers are built with MATH_NO_ERRNO
+  defined, in which case they only raise exceptions.
+
+  Without errno a function's result depends on nothing but its arguments, and
+  it has no effect the compiler needs to keep, so the declarations below are
+  marked const (__MATH_CONST). That lets the compiler merge repeated calls,
+  hoist calls out of loops and delete unused ones, like it does for its own
+  builtins with -fno-math-errno. Like those, it assumes the rounding mode isn't
+  changed in between calls. (Not in MATH_STATS builds, where calls have to be
+  counted.)
+
+*/
+#ifdef MATH_NO_ERRNO
+  #define math_errhandling MATH_ERREXCEPT
+#else
+  #define math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)
+#endif
+
+#if defined(MATH_NO_ERRNO) && defined(__GNUC__) && !defined(MATH_STATS)
+  #define __MATH_CONST __attribute__((const))
+#else
+  #define __MATH_CONST
+#endif
+
+/*
+
+  cos, sin, tan, exp and log, and cosf, sinf and tanf, also come in vector
+  forms under the x86-64 vector function ABI (src/math/vector_abi.c), and are
+  declared simd (__MATH_SIMD) so that GCC can call those when it vectorizes a
+  loop over them, as it would libmvec's. It does that for plain loops only
+  when they are also const, so with MATH_NO_ERRNO, and otherwise only in loops
+  marked #pragma omp simd (with -fopenmp-simd). The vector forms set errno and
+  give the same results as the scalar functions, bar the roundings FMA
+  changes.
+
+  The definitions of these functions are marked noclone (__MATH_NOCLONE),
+  since GCC would otherwise generate vector forms of its own alongside each
+  one, under the same names as those in vector_abi.c.
+
+*/
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    !defined(MATH_STATS)
+  #define __MATH_SIMD __attribute__((__simd__("notinbranch")))
+  #define __MATH_NOCLONE __attribute__((__noclone__))
+#else
+  #define __MATH_SIMD
+  #define __MATH_NOCLONE
+#endif
 
 /*
 
@@ -131,7 +196,8 @@
   of its argument
 
 */
-#define fpclassify(x)
+#define fpclassify(x) \
+  __builtin_fpclassify(FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)
 
 /*
 
@@ -143,7 +209,7 @@
   Returns a nonzero value if and only if its argument has a finite value
 
 */
-#define isfinite(x)
+#define isfinite(x) __builtin_isfinite(x)
 
 /*
 
@@ -155,7 +221,7 @@
   Returns a nonzero value if and only if its argument has an infinite value
 
 */
-#define isinf(x)
+#define isinf(x) __builtin_isinf(x)
 
 /*
 
@@ -166,7 +232,7 @@
   Returns a nonzero value if and only if its argument has a NaN value
 
 */
-#define isnan(x)
+#define isnan(x) __builtin_isnan(x)
 
 /*
 
@@ -178,7 +244,7 @@
   Returns a nonzero value if and only if its argument has a normal value
 
 */
-#define isnormal(x)
+#define isnormal(x) __builtin_isnormal(x)
 
 /*
 
@@ -188,7 +254,7 @@
   negative
 
 */
-#define signbit(x)
+#define signbit(x) __builtin_signbit(x)
 
 
 /*
@@ -200,9 +266,9 @@
   Returns arccos x in the interval [0,pi] radians
 
 */
-double acos(double x);
-float acosf(float x);
-long double acosl(long double x);
+double acos(double x) __MATH_CONST;
+float acosf(float x) __MATH_CONST;
+long double acosl(long double x) __MATH_CONST;
 
 
 /*
@@ -214,9 +280,9 @@ long double acosl(long double x);
   Returns arcsin x in the interval [-pi/2,pi/2] radians
 
 */
-double asin(double x);
-float asinf(float x);
-long double asinl(long double x);
+double asin(double x) __MATH_CONST;
+float asinf(float x) __MATH_CONST;
+long double asinl(long double x) __MATH_CONST;
 
 
 /*
@@ -227,9 +293,9 @@ long double asinl(long double x);
 
 */
 
-double atan(double x);
-float atanf(float x);
-long double atanl(long double x);
+double atan(double x) __MATH_CONST;
+float atanf(float x) __MATH_CONST;
+long double atanl(long double x) __MATH_CONST;
 
 
 /*
@@ -242,9 +308,9 @@ long double atanl(long double x);
   Returns arctan y/x in the interval [-pi.pi] radians
 
 */
-double atan2(double y, double x);
-float atan2f(float y, float x);
-long double atan2l(long double y, long double x);
+double atan2(double y, double x) __MATH_CONST;
+float atan2f(float y, float x) __MATH_CONST;
+long double atan2l(long double y, long double x) __MATH_CONST;
 
 
 /*
@@ -254,9 +320,9 @@ long double atan2l(long double y, long double x);
   Returns cos x
 
 */
-double cos(double x);
-float cosf(float x);
-long double cosl(long double x);
+double cos(double x) __MATH_CONST __MATH_SIMD;
+float cosf(float x) __MATH_CONST __MATH_SIMD;
+long double cosl(long double x) __MATH_CONST;
 
 
 /*
@@ -266,9 +332,9 @@ long double cosl(long double x);
   Returns sin x
 
 */
-double sin(double x);
-float sinf(float x);
-long double sinl(long double x);
+double sin(double x) __MATH_CONST __MATH_SIMD;
+float sinf(float x) __MATH_CONST __MATH_SIMD;
+long double sinl(long double x) __MATH_CONST;
 
 
 /*
@@ -278,9 +344,9 @@ long double sinl(long double x);
   Returns tan x
 
 */
-double tan(double x);
-float tanf(float x);
-long double tanl(long double x);
+double tan(double x) __MATH_CONST __MATH_SIMD;
+float tanf(float x) __MATH_CONST __MATH_SIMD;
+long double tanl(long double x) __MATH_CONST;
 
 
 /*
@@ -292,9 +358,9 @@ long double tanl(long double x);
   Returns arcosh x in the interval [0,inf]
 
 */
-double acosh(double x);
-float acoshf(float x);
-long double acoshl(long double x);
+double acosh(double x) __MATH_CONST;
+float acoshf(float x) __MATH_CONST;
+long double acoshl(long double x) __MATH_CONST;
 
 
 /*
@@ -304,9 +370,9 @@ long double acoshl(long double x);
   Returns arsinh x
 
 */
-double asinh(double x);
-float asinhf(float x);
-long double asinhl(long double x);
+double asinh(double x) __MATH_CONST;
+float asinhf(float x) __MATH_CONST;
+long double asinhl(long double x) __MATH_CONST;
 
 
 /*
@@ -320,9 +386,9 @@ long double asinhl(long double x);
   Returns artanh x
 
 */
-double atanh(double x);
-float atanhf(float x);
-long double atanhl(long double x);
+double atanh(double x) __MATH_CONST;
+float atanhf(float x) __MATH_CONST;
+long double atanhl(long double x) __MATH_CONST;
 
 
 /*
@@ -334,9 +400,9 @@ long double atanhl(long double x);
   Returns cosh x
 
 */
-double cosh(double x);
-float coshf(float x);
-long double coshl(long double x);
+double cosh(double x) __MATH_CONST;
+float coshf(float x) __MATH_CONST;
+long double coshl(long double x) __MATH_CONST;
 
 
 /*
@@ -348,9 +414,9 @@ long double coshl(long double x);
   Returns sinh x
 
 */
-double sinh(double x);
-float sinhf(float x);
-long double sinhl(long double x);
+double sinh(double x) __MATH_CONST;
+float sinhf(float x) __MATH_CONST;
+long double sinhl(long double x) __MATH_CONST;
 
 
 /*
@@ -360,9 +426,9 @@ long double sinhl(long double x);
   Returns tanh x
 
 */
-double tanh(double x);
-float tanhf(float x);
-long double tanhl(long double x);
+double tanh(double x) __MATH_CONST;
+float tanhf(float x) __MATH_CONST;
+long double tanhl(long double x) __MATH_CONST;
 
 
 /*
@@ -374,9 +440,9 @@ long double tanhl(long double x);
   Returns e^x
 
 */
-double exp(double x);
-float expf(float x);
-long double(long double x);
+double exp(double x) __MATH_CONST __MATH_SIMD;
+float expf(float x) __MATH_CONST;
+long double expl(long double x) __MATH_CONST;
 
 
 /*
@@ -388,9 +454,9 @@ long double(long double x);
   Returns 2^x
 
 */
-double exp2(double x);
-float exp2f(float x);
-long double exp2l(long double x);
+double exp2(double x) __MATH_CONST;
+float exp2f(float x) __MATH_CONST;
+long double exp2l(long double x) __MATH_CONST;
 
 
 /*
@@ -402,9 +468,9 @@ long double exp2l(long double x);
   Returns e^x-1
 
 */
-double expm1(double x);
-float expm1f(float x);
-long double expm1l(long double x);
+double expm1(double x) __MATH_CONST;
+float expm1f(float x) __MATH_CONST;
+long double expm1l(long double x) __MATH_CONST;
 
 
 /*
@@ -439,9 +505,9 @@ long double frexpl(long double value, int *exp);
   Returns the exponent of x as a signed int value
 
 */
-int ilogb(double x);
-int ilogbf(float x);
-int ilogbl(long double x);
+int ilogb(double x) __MATH_CONST;
+int ilogbf(float x) __MATH_CONST;
+int ilogbl(long double x) __MATH_CONST;
 
 
 /*
@@ -453,9 +519,9 @@ int ilogbl(long double x);
   Returns x*2^exp
 
 */
-double ldexp(double x, int exp);
-float ldexpf(float x, int exp);
-long double ldexpl(long double x, int exp);
+double ldexp(double x, int exp) __MATH_CONST;
+float ldexpf(float x, int exp) __MATH_CONST;
+long double ldexpl(long double x, int exp) __MATH_CONST;
 
 
 /*
@@ -469,9 +535,9 @@ long double ldexpl(long double x, int exp);
   Returns log_e x
 
 */
-double log(double x);
-float logf(float x);
-long double logl(long double x);
+double log(double x) __MATH_CONST __MATH_SIMD;
+float logf(float x) __MATH_CONST;
+long double logl(long double x) __MATH_CONST;
 
 
 /*
@@ -485,9 +551,9 @@ long double logl(long double x);
   Returns log_10 x
 
 */
-double log10(double x);
-float log10f(float x);
-long double log10l(long double x);
+double log10(double x) __MATH_CONST;
+float log10f(float x) __MATH_CONST;
+long double log10l(long double x) __MATH_CONST;
 
 
 /*
@@ -501,9 +567,9 @@ long double log10l(long double x);
   Returns log_e(1+x)
 
 */
-double log1p(double x);
-float log1pf(float x);
-long double log1pl(long double x);
+double log1p(double x) __MATH_CONST;
+float log1pf(float x) __MATH_CONST;
+long double log1pl(long double x) __MATH_CONST;
 
 
 /*
@@ -517,9 +583,9 @@ long double log1pl(long double x);
   Returns log_2 x
 
 */
-double log2(double x);
-float log2f(float x);
-long double log2l(long double x);
+double log2(double x) __MATH_CONST;
+float log2f(float x) __MATH_CONST;
+long double log2l(long double x) __MATH_CONST;
 
 
 /*
@@ -534,9 +600,9 @@ long double log2l(long double x);
   Returns the signed exponent of x
 
 */
-double logb(double x);
-float logbf(float x);
-long double logbl(long double x);
+double logb(double x) __MATH_CONST;
+float logbf(float x) __MATH_CONST;
+long double logbl(long double x) __MATH_CONST;
 
 
 /*
@@ -563,12 +629,12 @@ long double modfl(long double value, long double *iptr);
   Returns x * FLT_RADIX^n
 
 */
-double scalbn(double x, int n);
-float scalbnf(float x, int n);
-long double scalbnl(long double x, int n);
-double scalbln(double x, long int n);
-float scalblnf(float x, long int n);
-long double scalblnl(long double x, long int n);
+double scalbn(double x, int n) __MATH_CONST;
+float scalbnf(float x, int n) __MATH_CONST;
+long double scalbnl(long double x, int n) __MATH_CONST;
+double scalbln(double x, long int n) __MATH_CONST;
+float scalblnf(float x, long int n) __MATH_CONST;
+long double scalblnl(long double x, long int n) __MATH_CONST;
 
 
 /*
@@ -578,9 +644,9 @@ long double scalblnl(long double x, long int n);
   Returns x^1/3
 
 */
-double cbrt(double x);
-float cbrtf(float x);
-long double cbrtl(long double x);
+double cbrt(double x) __MATH_CONST;
+float cbrtf(float x) __MATH_CONST;
+long double cbrtl(long double x) __MATH_CONST;
 
 
 /*
@@ -590,9 +656,9 @@ long double cbrtl(long double x);
   Returns |x|
 
 */
-double fabs(double x);
-float fabsf(float x);
-long double fabsl(long double x);
+double fabs(double x) __MATH_CONST;
+float fabsf(float x) __MATH_CONST;
+long double fabsl(long double x) __MATH_CONST;
 
 
 /*
@@ -605,9 +671,9 @@ long double fabsl(long double x);
   Returns sqrt(x^2+y^2)
 
 */
-double hypot(double x, double y);
-float hypotf(float x, float y);
-long double hypotl(long double x, long double y);
+double hypot(double x, double y) __MATH_CONST;
+float hypotf(float x, float y) __MATH_CONST;
+long double hypotl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -626,9 +692,9 @@ long double hypotl(long double x, long double y);
   Returns x^y
 
 */
-double pow(double x, double y);
-float powf(float x, float y);
-long double powl(long double x, long double y);
+double pow(double x, double y) __MATH_CONST;
+float powf(float x, float y) __MATH_CONST;
+long double powl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -640,9 +706,9 @@ long double powl(long double x, long double y);
   Returns sqrt(x)
 
 */
-double sqrt(double x);
-float sqrtf(float x);
-long double sqrtl(long double x);
+double sqrt(double x) __MATH_CONST;
+float sqrtf(float x) __MATH_CONST;
+long double sqrtl(long double x) __MATH_CONST;
 
 
 /*
@@ -652,9 +718,9 @@ long double sqrtl(long double x);
   Returns erf x = (2/sqrt(pi)) * (integrate from 0 to x (e^(-t^2)) with respect to t)
 
 */
-double erf(double x);
-float erff(float x);
-long double erfl(long double x);
+double erf(double x) __MATH_CONST;
+float erff(float x) __MATH_CONST;
+long double erfl(long double x) __MATH_CONST;
 
 
 /*
@@ -666,9 +732,9 @@ long double erfl(long double x);
   Returns erfc x = 1 - erf x = (2/sqrt(pi)) * (integrate from x to infinity (e^(-t^2)) with respect to t)
 
 */
-double erfc(double x);
-float erfcf(float x);
-long double erfcl(long double x);
+double erfc(double x) __MATH_CONST;
+float erfcf(float x) __MATH_CONST;
+long double erfcl(long double x) __MATH_CONST;
 
 
 /*
@@ -682,9 +748,9 @@ long double erfcl(long double x);
   Returns log_e|gamma(x)|
 
 */
-double lgamma(double x);
-float lgammaf(float x);
-long double lgammal(long double x);
+double lgamma(double x) __MATH_CONST;
+float lgammaf(float x) __MATH_CONST;
+long double lgammal(long double x) __MATH_CONST;
 
 
 /*
@@ -699,9 +765,9 @@ long double lgammal(long double x);
   Returns gamma(x)
 
 */
-double tgamma(double x);
-float tgammaf(float x);
-long double tgammal(long double x);
+double tgamma(double x) __MATH_CONST;
+float tgammaf(float x) __MATH_CONST;
+long double tgammal(long double x) __MATH_CONST;
 
 
 /*
@@ -711,9 +777,9 @@ long double tgammal(long double x);
   Returns ceil(x), expressed as a floating-point number
 
 */
-double ceil(double x);
-float ceilf(float x);
-long double ceill(long double x);
+double ceil(double x) __MATH_CONST;
+float ceilf(float x) __MATH_CONST;
+long double ceill(long double x) __MATH_CONST;
 
 
 /*
@@ -723,9 +789,9 @@ long double ceill(long double x);
   Returns floor(x), expressed as a floating-point number
 
 */
-double floor(double x);
-float floorf(float x);
-long double floorl(long double x);
+double floor(double x) __MATH_CONST;
+float floorf(float x) __MATH_CONST;
+long double floorl(long double x) __MATH_CONST;
 
 
 /*
@@ -736,9 +802,9 @@ long double floorl(long double x);
   Returns the rounded integer value
 
 */
-double nearbyint(double x);
-float nearbyintf(float x);
-long double nearbyintl(long double x);
+double nearbyint(double x) __MATH_CONST;
+float nearbyintf(float x) __MATH_CONST;
+long double nearbyintl(long double x) __MATH_CONST;
 
 
 /*
@@ -749,9 +815,9 @@ long double nearbyintl(long double x);
   Returns the rounded integer value
 
 */
-double rint(double x);
-float rintf(float x);
-long double rintl(long double x);
+double rint(double x) __MATH_CONST;
+float rintf(float x) __MATH_CONST;
+long double rintl(long double x) __MATH_CONST;
 
 
 /*
@@ -763,12 +829,12 @@ long double rintl(long double x);
   Returns the rounded integer value
 
 */
-long int lrint(double x);
-long int lrintf(float x);
-long int lrintl(long double x);
-long long int llrint(double x);
-long long int llrintf(float x);
-long long int llrintl(long double x);
+long int lrint(double x) __MATH_CONST;
+long int lrintf(float x) __MATH_CONST;
+long int lrintl(long double x) __MATH_CONST;
+long long int llrint(double x) __MATH_CONST;
+long long int llrintf(float x) __MATH_CONST;
+long long int llrintl(long double x) __MATH_CONST;
 
 
 /*
@@ -779,9 +845,9 @@ long long int llrintl(long double x);
   Returns the rounded integer value
 
 */
-double round(double x);
-float roundf(float x);
-long double roundl(long double x);
+double round(double x) __MATH_CONST;
+float roundf(float x) __MATH_CONST;
+long double roundl(long double x) __MATH_CONST;
 
 
 /*
@@ -794,12 +860,12 @@ long double roundl(long double x);
   Returns the rounded integer value
 
 */
-long int lround(double x);
-long int lroundf(float x);
-long int lroundl(long double x);
-long long int llround(double x);
-long long int llroundf(float x);
-long long int llroundl(long double x);
+long int lround(double x) __MATH_CONST;
+long int lroundf(float x) __MATH_CONST;
+long int lroundl(long double x) __MATH_CONST;
+long long int llround(double x) __MATH_CONST;
+long long int llroundf(float x) __MATH_CONST;
+long long int llroundl(long double x) __MATH_CONST;
 
 
 /*
@@ -810,9 +876,9 @@ long long int llroundl(long double x);
   Returns the truncated integer value
 
 */
-double trunc(double x);
-float truncf(float x);
-long double truncl(long double x);
+double trunc(double x) __MATH_CONST;
+float truncf(float x) __MATH_CONST;
+long double truncl(long double x) __MATH_CONST;
 
 
 /*
@@ -825,9 +891,9 @@ long double truncl(long double x);
   is implementation-defined
 
 */
-double fmod(double x, double y);
-float fmodf(float x, float y);
-long double fmodl(long double x, long double y);
+double fmod(double x, double y) __MATH_CONST;
+float fmodf(float x, float y) __MATH_CONST;
+long double fmodl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -838,9 +904,9 @@ long double fmodl(long double x, long double y);
   return zero is implementation defined
 
 */
-double remainder(double x, double y);
-float remainderf(float x, float y);
-long double remainderl(long double x, long double y);
+double remainder(double x, double y) __MATH_CONST;
+float remainderf(float x, float y) __MATH_CONST;
+long double remainderl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -870,9 +936,9 @@ long double remquol(long double x, long double y, int *quo);
   Returns a value with the magnitude of x and the sign of y
 
 */
-double copysign(double x, double y);
-float copysignf(float x, float y);
-long double copysignl(long double x, long double y);
+double copysign(double x, double y) __MATH_CONST;
+float copysignf(float x, float y) __MATH_CONST;
+long double copysignl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -911,9 +977,9 @@ long double nanl(const char *tagp);
   direction of y.
 
 */
-double nextafter(double x, double y);
-float nextafterf(float x, float y);
-long double nextafterl(long double x, long double y);
+double nextafter(double x, double y) __MATH_CONST;
+float nextafterf(float x, float y) __MATH_CONST;
+long double nextafterl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -922,9 +988,9 @@ long double nextafterl(long double x, long double y);
   of the function if x equals y
 
 */
-double nexttoward(double x, long double y);
-float nexttowardf(float x, long double y);
-long double nexttowardl(long double x, long double y);
+double nexttoward(double x, long double y) __MATH_CONST;
+float nexttowardf(float x, long double y) __MATH_CONST;
+long double nexttowardl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -937,9 +1003,9 @@ long double nexttowardl(long double x, long double y);
   Returns 0 if x <= y
 
 */
-double fdim(double x, double y);
-float fdimf(float x, float y);
-long double fdiml(long double x, long double y);
+double fdim(double x, double y) __MATH_CONST;
+float fdimf(float x, float y) __MATH_CONST;
+long double fdiml(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -949,9 +1015,9 @@ long double fdiml(long double x, long double y);
   Returns the maximum numeric value of their arguments
 
 */
-double fmax(double x, double y);
-float fmaxf(float x, float y);
-long double fmaxl(long double x, long double y);
+double fmax(double x, double y) __MATH_CONST;
+float fmaxf(float x, float y) __MATH_CONST;
+long double fmaxl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -961,9 +1027,9 @@ long double fmaxl(long double x, long double y);
   Returns the minimum numeric value of their arguments
 
 */
-double fmin(double x, double y);
-float fminf(float x, float y);
-long double fminl(long double x, long double y);
+double fmin(double x, double y) __MATH_CONST;
+float fminf(float x, float y) __MATH_CONST;
+long double fminl(long double x, long double y) __MATH_CONST;
 
 
 /*
@@ -977,9 +1043,9 @@ long double fminl(long double x, long double y);
   Returns (x*y)+z rounded as one ternary operation
 
 */
-double fma(double x, double y, double z);
-float fmaf(float x, float y, float z);
-long double fmal(long double x, long double y, long double z);
+double fma(double x, double y, double z) __MATH_CONST;
+float fmaf(float x, float y, float z) __MATH_CONST;
+long double fmal(long double x, long double y, long double z) __MATH_CONST;
 
 
 /*
@@ -992,7 +1058,7 @@ long double fmal(long double x, long double y, long double z);
   Returns the value of x > y
 
 */
-#define isgreater(x, y);
+#define isgreater(x, y) __builtin_isgreater(x, y)
 
 
 /*
@@ -1004,7 +1070,7 @@ long double fmal(long double x, long double y, long double z);
   Returns the value of x >= y
 
 */
-#define isgreaterequal(x,y);
+#define isgreaterequal(x, y) __builtin_isgreaterequal(x, y)
 
 
 /*
@@ -1016,7 +1082,7 @@ long double fmal(long double x, long double y, long double z);
   Returns the value of x < y
 
 */
-#define isless(x,y);
+#define isless(x, y) __builtin_isless(x, y)
 
 
 /*
@@ -1028,7 +1094,7 @@ long double fmal(long double x, long double y, long double z);
   Returns x <= y
 
 */
-#define islessequal(x,y);
+#define islessequal(x, y) __builtin_islessequal(x, y)
 
 
 /*
@@ -1040,7 +1106,7 @@ long double fmal(long double x, long double y, long double z);
   Returns the value of x<y || x>y
 
 */
-#define islessgreater(x,y);
+#define islessgreater(x, y) __builtin_islessgreater(x, y)
 
 
 /*
@@ -1050,4 +1116,441 @@ long double fmal(long double x, long double y, long double z);
   Returns 1 if its arguments are unordered and 0 otherwise
 
 */
-#define isunordered(x,y);
+#define isunordered(x, y) __builtin_isunordered(x, y)
+
+
+/*
+
+  Everything below is not part of C17. These are extensions for code that
+  works on whole arrays of arguments at once.
+
+*/
+#include <stddef.h>
+
+
+/*
+
+  Computes both the sine and cosine of x (measured in radians), storing them in
+  the objects pointed to by sinx and cosx. Cheaper than calling sin and cos
+  separately, since the argument is only reduced once.
+
+*/
+void sincos(double x, double *sinx, double *cosx);
+
+
+/*
+
+  Compute sinx[i] = sin(x[i]) and cosx[i] = cos(x[i]) for i in [0,n).
+
+  sincos_strided reads and writes element i at index i*stride of each array,
+  strides being counted in elements and allowed to be zero or negative.
+
+  sincos_interleaved writes cossin[2i] = cos(x[i]) and cossin[2i+1] = sin(x[i]),
+  which is the layout of an array of double complex.
+
+*/
+void sincos_batch(const double *x, double *sinx, double *cosx, size_t n);
+void sincos_strided(const double *x, ptrdiff_t xstride,
+                    double *sinx, ptrdiff_t sstride,
+                    double *cosx, ptrdiff_t cstride, size_t n);
+void sincos_interleaved(const double *x, ptrdiff_t xstride, double *cossin,
+                        size_t n);
+
+
+/*
+
+  Computes s[i] = sin(x0 + i*dx) and c[i] = cos(x0 + i*dx) for i in [0,n).
+
+  Each angle is reached from the one before by rotating through dx, with
+  periodic exact restarts to keep errors from building up. Meant for
+  oscillators and twiddle factors, where it is several times faster than
+  calling sincos for each angle, with errors of up to about 8 units in the last
+  place.
+
+*/
+void sincos_sequence(double x0, double dx, size_t n, double *s, double *c);
+
+
+/*
+
+  Compute sin(pi*t), cos(pi*t) and tan(pi*t), where t is measured in half turns
+  (as in C23 and IEC 60559).
+
+  Reducing an angle in half turns is exact, so these are both faster and more
+  accurate than passing M_PI*t to sin, cos or tan.
+
+  sinpi(n) is +0 for positive whole numbers n and -0 for negative ones.
+  cospi(n+1/2) is +0. tanpi(n) is +0 for positive even and negative odd n, -0
+  otherwise.
+
+  Pole error occurs for tanpi(n+1/2), which returns +infinity for even n and
+  -infinity for odd n
+
+*/
+double sinpi(double t) __MATH_CONST;
+float sinpif(float t) __MATH_CONST;
+double cospi(double t) __MATH_CONST;
+float cospif(float t) __MATH_CONST;
+double tanpi(double t) __MATH_CONST;
+float tanpif(float t) __MATH_CONST;
+
+
+/*
+
+  Compute y[i] = sinpi(t[i]), cospi(t[i]) or tanpi(t[i]) for i in [0,n)
+
+*/
+void sinpi_batch(const double *t, double *y, size_t n);
+void cospi_batch(const double *t, double *y, size_t n);
+void tanpi_batch(const double *t, double *y, size_t n);
+
+
+/*
+
+  Compute sin(x) and cos(x) for arguments the caller already knows to be
+  small, skipping what sin and cos do to find that out.
+
+  __sin_kernel and __cos_kernel are the bare polynomials, for |x| <= pi/4: no
+  checks and no reduction at all. sin_bounded and cos_bounded are for
+  |x| <= pi, with a reduction that takes a handful of operations and no
+  branches. Both are as accurate as sin and cos within their domain. Outside
+  it (including for infinities and NaNs) the results are unspecified, and
+  errno is never set.
+
+  The _batch forms compute y[i] for x[i], i in [0,n).
+
+*/
+double __sin_kernel(double x) __MATH_CONST;
+double __cos_kernel(double x) __MATH_CONST;
+double sin_bounded(double x) __MATH_CONST;
+double cos_bounded(double x) __MATH_CONST;
+
+void __sin_kernel_batch(const double *x, double *y, size_t n);
+void __cos_kernel_batch(const double *x, double *y, size_t n);
+void sin_bounded_batch(const double *x, double *y, size_t n);
+void cos_bounded_batch(const double *x, double *y, size_t n);
+
+
+/*
+
+  Compute the sine and cosine of an angle given as an unsigned binary fraction
+  of a full turn, so 2^32 (or 2^16) is 2*pi radians, without any floating
+  point range reduction. Meant for fixed-point signal processing.
+
+  The q32 functions return Q1.31 (2^31 times the result), the q16 functions
+  Q1.15, and sinf_q32/cosf_q32 a float. 1.0 saturates to the largest
+  representable Q1.31 or Q1.15 value, while -1.0 is exactly the smallest.
+
+  The batch forms compute y[i] from turns[i] for i in [0,n).
+
+*/
+#include <stdint.h>
+
+int32_t sin_q32(uint32_t turns) __MATH_CONST;
+int32_t cos_q32(uint32_t turns) __MATH_CONST;
+int16_t sin_q16(uint16_t turns) __MATH_CONST;
+int16_t cos_q16(uint16_t turns) __MATH_CONST;
+float sinf_q32(uint32_t turns) __MATH_CONST;
+float cosf_q32(uint32_t turns) __MATH_CONST;
+
+void sin_q32_batch(const uint32_t *turns, int32_t *y, size_t n);
+void cos_q32_batch(const uint32_t *turns, int32_t *y, size_t n);
+void sin_q16_batch(const uint16_t *turns, int16_t *y, size_t n);
+void cos_q16_batch(const uint16_t *turns, int16_t *y, size_t n);
+void sinf_q32_batch(const uint32_t *turns, float *y, size_t n);
+void cosf_q32_batch(const uint32_t *turns, float *y, size_t n);
+
+
+/*
+
+  Compute y[i] = cos, sin, exp or tanh of x[i] for i in [0,n), on arrays of 16
+  bit floating point numbers given as their bit patterns: IEEE binary16
+  (_Float16) for the f16 functions and bfloat16 for the bf16 ones. Arrays of
+  _Float16 can be passed with a cast.
+
+  Values are widened to float in registers and evaluated with kernels meant for
+  16 bit results, so memory traffic stays at two bytes per value. Results are
+  within about one unit in the last place of the 16 bit format.
+
+*/
+void cos_f16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void sin_f16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void exp_f16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void tanh_f16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void cos_bf16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void sin_bf16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void exp_bf16_batch(const uint16_t *x, uint16_t *y, size_t n);
+void tanh_bf16_batch(const uint16_t *x, uint16_t *y, size_t n);
+
+
+/*
+
+  Compute m[i] = frexp(x[i], &e[i]), y[i] = ldexp(x[i], e[i]),
+  y[i] = ilogb(x[i]), y[i] = logb(x[i]) and frac[i] = modf(x[i], &ip[i]) for
+  i in [0,n). The double outputs may be the same array as x.
+
+  Normal numbers are handled with integer operations on their bit patterns in
+  loops that vectorize, anything else (zeros, subnormals, infinities and NaNs)
+  separately afterwards.
+
+*/
+void frexp_batch(const double *x, double *m, int *e, size_t n);
+void ldexp_batch(const double *x, const int *e, double *y, size_t n);
+void ilogb_batch(const double *x, int *y, size_t n);
+void logb_batch(const double *x, double *y, size_t n);
+void modf_batch(const double *x, double *frac, double *ip, size_t n);
+
+
+/*
+
+  Return the largest and the smallest of x[0] to x[n-1]. NaNs are ignored, as
+  fmax and fmin ignore them, so the result is NaN only if n is 0 or every
+  element is a NaN. Several running maxima or minima are kept, so the
+  comparisons vectorize.
+
+*/
+double fmax_reduce(const double *x, size_t n);
+double fmin_reduce(const double *x, size_t n);
+
+
+/*
+
+  Return the sum of x[0] to x[n-1], of x[i]*y[i], of log(x[i]) and of
+  e^x[i], for i in [0,n).
+
+  The sums are compensated: the rounding error of every addition (and
+  product) is kept and added back at the end, so the result is as accurate as
+  summing in twice double precision, whatever the order and size of the terms.
+  Several sums are kept side by side, so the loops vectorize. logsum_reduce
+  and expsum_reduce compute each logarithm or exponential as they go, without
+  writing them to memory.
+
+  logsum_reduce is the logarithm of the product of the elements, and is -inf
+  if one is zero and NaN if one is negative. expsum_reduce overflows when the
+  sum would; for a softmax, subtract the largest element first. None of them
+  set errno, and all of them return 0 for n = 0.
+
+*/
+double sum_reduce(const double *x, size_t n);
+double dot_reduce(const double *x, const double *y, size_t n);
+double logsum_reduce(const double *x, size_t n);
+double expsum_reduce(const double *x, size_t n);
+
+
+/*
+
+  Compute y[i] = x[i] rounded to an integer in the current rounding direction,
+  as lrint does, for i in [0,n), for quantizing samples. Results out of the
+  range of y's type saturate to its smallest or largest value and NaNs become
+  0, with no exception raised and errno left alone.
+
+  Rounding is done with floating point additions and the integer taken from
+  the bit pattern of the sum, so the loops vectorize where a conversion
+  instruction per element wouldn't.
+
+*/
+void lrint_i16_batch(const double *x, int16_t *y, size_t n);
+void lrint_i32_batch(const double *x, int32_t *y, size_t n);
+void lrint_i64_batch(const double *x, int64_t *y, size_t n);
+void lrintf_i16_batch(const float *x, int16_t *y, size_t n);
+void lrintf_i32_batch(const float *x, int32_t *y, size_t n);
+void lrintf_i64_batch(const float *x, int64_t *y, size_t n);
+
+
+/*
+
+  Turns flushing of subnormal numbers on or off in the batch functions above
+  (everything taking arrays, bar fmax_reduce and fmin_reduce, which only
+  compare), for the calling thread only, and returns the previous setting.
+
+  While on, each batch call runs with the processor's flush-to-zero and
+  denormals-are-zero modes set (MXCSR on x86, FPCR on AArch64), restoring them
+  before it returns. Subnormal arguments and results are then treated as zero,
+  which avoids the large slowdown many processors have for subnormal
+  arithmetic, at the cost of exact results for those values. To scope it to a
+  single call:
+
+    int previous = math_flush_subnormals(1);
+    sincos_batch(x, s, c, n);
+    math_flush_subnormals(previous);
+
+  Off by default. Does nothing on other processors.
+
+*/
+int math_flush_subnormals(int enable);
+
+
+/*
+
+  Inline definitions of the functions that are only a few instructions long,
+  so that calls to them can be inlined and folded like the compiler's own
+  builtins. (The library has out-of-line copies too, for taking addresses and
+  for compilers without GNU inline semantics.) Define __MATH_NO_INLINE to
+  always call the library.
+
+  Everything here is branch-free: sign bit masks, and comparisons feeding a
+  select, which compile to compare and blend instructions and so also
+  vectorize. The comparisons are the quiet ones, so quiet NaN arguments raise
+  no exceptions.
+
+  fmin and fmax return the other argument when one is a NaN, and NaN only
+  when both are. nextafter and nexttoward return a NaN argument as it is.
+
+*/
+#ifndef __MATH_INLINES
+#define __MATH_INLINES
+
+#ifdef __GNUC__
+  #define __MATH_INLINE \
+    extern __inline __attribute__((__gnu_inline__, __always_inline__))
+#else
+  #define __MATH_INLINE static inline
+#endif
+
+__MATH_INLINE double __math_fmax(double x, double y){
+  return __builtin_isgreater(x, y) | (y != y) ? x : y;
+}
+
+__MATH_INLINE float __math_fmaxf(float x, float y){
+  return __builtin_isgreater(x, y) | (y != y) ? x : y;
+}
+
+__MATH_INLINE long double __math_fmaxl(long double x, long double y){
+  return __builtin_isgreater(x, y) | (y != y) ? x : y;
+}
+
+__MATH_INLINE double __math_fmin(double x, double y){
+  return __builtin_isless(x, y) | (y != y) ? x : y;
+}
+
+__MATH_INLINE float __math_fminf(float x, float y){
+  return __builtin_isless(x, y) | (y != y) ? x : y;
+}
+
+__MATH_INLINE long double __math_fminl(long double x, long double y){
+  return __builtin_isless(x, y) | (y != y) ? x : y;
+}
+
+
+/*
+
+  Both operands are replaced by zero when x <= y, rather than the difference
+  being computed and then thrown away, which could raise a spurious overflow.
+  A NaN makes the comparison false, so it gets through to the subtraction.
+
+*/
+__MATH_INLINE double __math_fdim(double x, double y){
+  int le = __builtin_islessequal(x, y);
+  return (le ? 0.0 : x) - (le ? 0.0 : y);
+}
+
+__MATH_INLINE float __math_fdimf(float x, float y){
+  int le = __builtin_islessequal(x, y);
+  return (le ? 0.0f : x) - (le ? 0.0f : y);
+}
+
+__MATH_INLINE long double __math_fdiml(long double x, long double y){
+  int le = __builtin_islessequal(x, y);
+  return (le ? 0.0L : x) - (le ? 0.0L : y);
+}
+
+
+/*
+
+  The neighbors of a finite nonzero number are its bit pattern plus and minus
+  one: plus one moves away from zero, minus one towards it. Zero is first given
+  the sign of the direction it moves in, so the step is always away from zero
+  there. The largest finite number steps to infinity.
+
+*/
+__MATH_INLINE double __math_nextafter(double x, double y){
+  union { double f; uint64_t i; } u = { x }, v = { y };
+  uint64_t i = x == 0 ? v.i & 0x8000000000000000u : u.i;
+  uint64_t away = __builtin_isless(x, y) ^ (i >> 63);
+  u.i = i + 2*away - 1;
+  double r = x == y ? y : u.f;
+  return x != x ? x : y != y ? y : r;
+}
+
+__MATH_INLINE float __math_nextafterf(float x, float y){
+  union { float f; uint32_t i; } u = { x }, v = { y };
+  uint32_t i = x == 0 ? v.i & 0x80000000u : u.i;
+  uint32_t away = __builtin_isless(x, y) ^ (i >> 31);
+  u.i = i + 2*away - 1;
+  float r = x == y ? y : u.f;
+  return x != x ? x : y != y ? y : r;
+}
+
+__MATH_INLINE double __math_nexttoward(double x, long double y){
+  union { double f; uint64_t i; } u = { x };
+  uint64_t sign = (uint64_t)(__builtin_signbit(y) != 0) << 63;
+  uint64_t i = x == 0 ? sign : u.i;
+  uint64_t away = __builtin_isless(x, y) ^ (i >> 63);
+  u.i = i + 2*away - 1;
+  double r = x == y ? (double)y : u.f;
+  return x != x ? x : y != y ? (double)y : r;
+}
+
+__MATH_INLINE float __math_nexttowardf(float x, long double y){
+  union { float f; uint32_t i; } u = { x };
+  uint32_t sign = (uint32_t)(__builtin_signbit(y) != 0) << 31;
+  uint32_t i = x == 0 ? sign : u.i;
+  uint32_t away = __builtin_isless(x, y) ^ (i >> 31);
+  u.i = i + 2*away - 1;
+  float r = x == y ? (float)y : u.f;
+  return x != x ? x : y != y ? (float)y : r;
+}
+
+
+#if defined(__GNUC__) && !defined(__MATH_NO_INLINE)
+
+__MATH_INLINE double fabs(double x){ return __builtin_fabs(x); }
+__MATH_INLINE float fabsf(float x){ return __builtin_fabsf(x); }
+__MATH_INLINE long double fabsl(long double x){ return __builtin_fabsl(x); }
+
+__MATH_INLINE double copysign(double x, double y){
+  return __builtin_copysign(x, y);
+}
+__MATH_INLINE float copysignf(float x, float y){
+  return __builtin_copysignf(x, y);
+}
+__MATH_INLINE long double copysignl(long double x, long double y){
+  return __builtin_copysignl(x, y);
+}
+
+__MATH_INLINE double fmax(double x, double y){ return __math_fmax(x, y); }
+__MATH_INLINE float fmaxf(float x, float y){ return __math_fmaxf(x, y); }
+__MATH_INLINE long double fmaxl(long double x, long double y){
+  return __math_fmaxl(x, y);
+}
+
+__MATH_INLINE double fmin(double x, double y){ return __math_fmin(x, y); }
+__MATH_INLINE float fminf(float x, float y){ return __math_fminf(x, y); }
+__MATH_INLINE long double fminl(long double x, long double y){
+  return __math_fminl(x, y);
+}
+
+__MATH_INLINE double fdim(double x, double y){ return __math_fdim(x, y); }
+__MATH_INLINE float fdimf(float x, float y){ return __math_fdimf(x, y); }
+__MATH_INLINE long double fdiml(long double x, long double y){
+  return __math_fdiml(x, y);
+}
+
+__MATH_INLINE double nextafter(double x, double y){
+  return __math_nextafter(x, y);
+}
+__MATH_INLINE float nextafterf(float x, float y){
+  return __math_nextafterf(x, y);
+}
+__MATH_INLINE double nexttoward(double x, long double y){
+  return __math_nexttoward(x, y);
+}
+__MATH_INLINE float nexttowardf(float x, long double y){
+  return __math_nexttowardf(x, y);
+}
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+/*
+
+  mathstats.h
+
+  Not part of C17. Optional instrumentation of the math library, to find out
+  which code paths and which kinds of arguments real programs actually hit.
+
+  Counting only happens when the library is compiled with MATH_STATS defined.
+  Otherwise the counting compiles away completely and every snapshot is zero.
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#ifndef MATHSTATS_H
+#define MATHSTATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+/*
+
+  The functions being counted
+
+*/
+enum math_stats_function {
+  MATH_STATS_COS,
+  MATH_STATS_SIN,
+  MATH_STATS_TAN,
+  MATH_STATS_SINCOS,
+  MATH_STATS_SINCOS_BATCH,
+  MATH_STATS_FUNCTIONS
+};
+
+
+/*
+
+  The ways through a function. Not every function has every path.
+
+  SMALL    arguments small enough to need no range reduction
+  MEDIUM   arguments reduced the quick way (Cody-Waite)
+  LARGE    arguments reduced with the slow multi-word method (Payne-Hanek)
+  SPECIAL  infinities, NaNs and other arguments handled up front
+  TINY     arguments so close to zero that the result is known without any
+           evaluation (and subnormals, which would be slow to evaluate)
+
+*/
+enum math_stats_path {
+  MATH_STATS_PATH_SMALL,
+  MATH_STATS_PATH_MEDIUM,
+  MATH_STATS_PATH_LARGE,
+  MATH_STATS_PATH_SPECIAL,
+  MATH_STATS_PATH_TINY,
+  MATH_STATS_PATHS
+};
+
+
+/*
+
+  Arguments are counted by magnitude, one bucket per power of two.
+
+  MATH_STATS_BUCKET_ZERO       +-0
+  MATH_STATS_BUCKET_SUBNORMAL  subnormal
+  MATH_STATS_BUCKET_TINY       normal and below 2^MATH_STATS_MIN_EXP
+  MATH_STATS_BUCKET_EXP(e)     2^e <= |x| < 2^(e+1), for e in
+                               [MATH_STATS_MIN_EXP, MATH_STATS_MAX_EXP]
+  MATH_STATS_BUCKET_HUGE       finite and at least 2^(MATH_STATS_MAX_EXP+1)
+  MATH_STATS_BUCKET_NONFINITE  infinite or NaN
+
+*/
+#define MATH_STATS_MIN_EXP (-32)
+#define MATH_STATS_MAX_EXP 63
+
+#define MATH_STATS_BUCKET_ZERO 0
+#define MATH_STATS_BUCKET_SUBNORMAL 1
+#define MATH_STATS_BUCKET_TINY 2
+#define MATH_STATS_BUCKET_EXP(e) (3 + (e) - MATH_STATS_MIN_EXP)
+#define MATH_STATS_BUCKET_HUGE MATH_STATS_BUCKET_EXP(MATH_STATS_MAX_EXP+1)
+#define MATH_STATS_BUCKET_NONFINITE (MATH_STATS_BUCKET_HUGE+1)
+#define MATH_STATS_BUCKETS (MATH_STATS_BUCKET_NONFINITE+1)
+
+
+/*
+
+  Counters for one function. Each one starts on its own cache line so that
+  functions used by different threads never share one.
+
+*/
+struct math_stats_counters {
+  _Alignas(64) uint64_t calls;
+  uint64_t path[MATH_STATS_PATHS];
+  uint64_t magnitude[MATH_STATS_BUCKETS];
+};
+
+struct math_stats {
+  struct math_stats_counters function[MATH_STATS_FUNCTIONS];
+};
+
+
+/*
+
+  Adds up the counters of every thread that has called an instrumented function
+  (including threads that have since exited) into *out.
+
+  Counters of running threads are read without stopping them, so a snapshot
+  taken while they run is a consistent count of each counter, not of all of
+  them at one instant.
+
+*/
+void math_stats_snapshot(struct math_stats *out);
+
+
+/*
+
+  Sets every counter of every thread back to zero
+
+*/
+void math_stats_reset(void);
+
+
+/*
+
+  Writes a snapshot as readable text to out, skipping counters that are zero
+
+*/
+void math_stats_dump(FILE *out);
+
+
+/*
+
+  Returns the name of a function or path, for printing
+
+*/
+const char *math_stats_function_name(enum math_stats_function f);
+const char *math_stats_path_name(enum math_stats_path p);
+
+#endif
@@ -0,0 +1,177 @@
+/*
+
+  tgmath.h as defined by C17 ISO/IEC 9899:2017
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#ifndef TGMATH_H
+#define TGMATH_H
+
+#include "math.h"
+#include "complex.h"
+
+/*
+
+  Each function of math.h and complex.h with a float, double and long double
+  version is replaced by a type-generic macro of the same name (without a
+  suffix), which calls the version for the type of its arguments. The choice
+  is made at compile time with _Generic, so cos(x) of a float x calls cosf,
+  with no conversion to double and back.
+
+  The type is found as in C17 7.25: an argument of integer type counts as
+  double, and otherwise the arguments are combined by the usual arithmetic
+  conversions, so a float and a double call the double version, and any
+  complex argument calls the complex version. Only the arguments listed as
+  generic count (not the int of ldexp or the long double of nexttoward).
+
+  Functions with both real and complex versions call the complex one for
+  complex arguments (with fabs going to cabs). Those with only a complex
+  version (carg, cimag, conj, cproj, creal) call it for real arguments too,
+  and those with only a real version are for real arguments only.
+
+  This library doesn't implement every version these macros can call, and a
+  call that lands on a missing one fails to link, where without this header a
+  float or long double argument would have been converted to double. Of the
+  functions it does implement, the versions missing are cosl, sinl, tanl,
+  expl, logl, atan2f, atan2l, hypotf and hypotl, and the float and long double
+  versions of ccos, csin, cexp, clog, cpow, cabs and carg. Convert arguments
+  to double (or double complex) for those.
+
+*/
+
+// An argument's type for choosing a version: integers count as double
+#define __TG_TYPE(x) _Generic((x), \
+  float: (x), \
+  long double: (x), \
+  float complex: (x), \
+  double complex: (x), \
+  long double complex: (x), \
+  default: (double)(x))
+
+#define __TG_TYPE2(x, y) (__TG_TYPE(x) + __TG_TYPE(y))
+#define __TG_TYPE3(x, y, z) (__TG_TYPE(x) + __TG_TYPE(y) + __TG_TYPE(z))
+
+// The version of a real function for an argument of type t
+#define __TG_REAL(t, fn) _Generic((t), \
+  float: fn##f, \
+  long double: fn##l, \
+  default: fn)
+
+// The version of a function with real and complex versions (cfn for complex)
+#define __TG_FULL(t, fn, cfn) _Generic((t), \
+  float: fn##f, \
+  long double: fn##l, \
+  float complex: cfn##f, \
+  double complex: cfn, \
+  long double complex: cfn##l, \
+  default: fn)
+
+// The version of a complex function, for a real or complex argument
+#define __TG_COMPLEX(t, cfn) _Generic((t), \
+  float: cfn##f, \
+  float complex: cfn##f, \
+  long double: cfn##l, \
+  long double complex: cfn##l, \
+  default: cfn)
+
+
+/*
+
+  Functions with real and complex versions
+
+*/
+#define acos(x) __TG_FULL(__TG_TYPE(x), acos, cacos)(x)
+#define asin(x) __TG_FULL(__TG_TYPE(x), asin, casin)(x)
+#define atan(x) __TG_FULL(__TG_TYPE(x), atan, catan)(x)
+#define acosh(x) __TG_FULL(__TG_TYPE(x), acosh, cacosh)(x)
+#define asinh(x) __TG_FULL(__TG_TYPE(x), asinh, casinh)(x)
+#define atanh(x) __TG_FULL(__TG_TYPE(x), atanh, catanh)(x)
+#define cos(x) __TG_FULL(__TG_TYPE(x), cos, ccos)(x)
+#define sin(x) __TG_FULL(__TG_TYPE(x), sin, csin)(x)
+#define tan(x) __TG_FULL(__TG_TYPE(x), tan, ctan)(x)
+#define cosh(x) __TG_FULL(__TG_TYPE(x), cosh, ccosh)(x)
+#define sinh(x) __TG_FULL(__TG_TYPE(x), sinh, csinh)(x)
+#define tanh(x) __TG_FULL(__TG_TYPE(x), tanh, ctanh)(x)
+#define exp(x) __TG_FULL(__TG_TYPE(x), exp, cexp)(x)
+#define log(x) __TG_FULL(__TG_TYPE(x), log, clog)(x)
+#define pow(x, y) __TG_FULL(__TG_TYPE2(x, y), pow, cpow)(x, y)
+#define sqrt(x) __TG_FULL(__TG_TYPE(x), sqrt, csqrt)(x)
+#define fabs(x) __TG_FULL(__TG_TYPE(x), fabs, cabs)(x)
+
+
+/*
+
+  Functions with only real versions
+
+*/
+#define atan2(y, x) __TG_REAL(__TG_TYPE2(y, x), atan2)(y, x)
+#define cbrt(x) __TG_REAL(__TG_TYPE(x), cbrt)(x)
+#define ceil(x) __TG_REAL(__TG_TYPE(x), ceil)(x)
+#define copysign(x, y) __TG_REAL(__TG_TYPE2(x, y), copysign)(x, y)
+#define erf(x) __TG_REAL(__TG_TYPE(x), erf)(x)
+#define erfc(x) __TG_REAL(__TG_TYPE(x), erfc)(x)
+#define exp2(x) __TG_REAL(__TG_TYPE(x), exp2)(x)
+#define expm1(x) __TG_REAL(__TG_TYPE(x), expm1)(x)
+#define fdim(x, y) __TG_REAL(__TG_TYPE2(x, y), fdim)(x, y)
+#define floor(x) __TG_REAL(__TG_TYPE(x), floor)(x)
+#define fma(x, y, z) __TG_REAL(__TG_TYPE3(x, y, z), fma)(x, y, z)
+#define fmax(x, y) __TG_REAL(__TG_TYPE2(x, y), fmax)(x, y)
+#define fmin(x, y) __TG_REAL(__TG_TYPE2(x, y), fmin)(x, y)
+#define fmod(x, y) __TG_REAL(__TG_TYPE2(x, y), fmod)(x, y)
+#define frexp(x, e) __TG_REAL(__TG_TYPE(x), frexp)(x, e)
+#define hypot(x, y) __TG_REAL(__TG_TYPE2(x, y), hypot)(x, y)
+#define ilogb(x) __TG_REAL(__TG_TYPE(x), ilogb)(x)
+#define ldexp(x, e) __TG_REAL(__TG_TYPE(x), ldexp)(x, e)
+#define lgamma(x) __TG_REAL(__TG_TYPE(x), lgamma)(x)
+#define llrint(x) __TG_REAL(__TG_TYPE(x), llrint)(x)
+#define llround(x) __TG_REAL(__TG_TYPE(x), llround)(x)
+#define log10(x) __TG_REAL(__TG_TYPE(x), log10)(x)
+#define log1p(x) __TG_REAL(__TG_TYPE(x), log1p)(x)
+#define log2(x) __TG_REAL(__TG_TYPE(x), log2)(x)
+#define logb(x) __TG_REAL(__TG_TYPE(x), logb)(x)
+#define lrint(x) __TG_REAL(__TG_TYPE(x), lrint)(x)
+#define lround(x) __TG_REAL(__TG_TYPE(x), lround)(x)
+#define nearbyint(x) __TG_REAL(__TG_TYPE(x), nearbyint)(x)
+#define nextafter(x, y) __TG_REAL(__TG_TYPE2(x, y), nextafter)(x, y)
+#define nexttoward(x, y) __TG_REAL(__TG_TYPE(x), nexttoward)(x, y)
+#define remainder(x, y) __TG_REAL(__TG_TYPE2(x, y), remainder)(x, y)
+#define remquo(x, y, quo) __TG_REAL(__TG_TYPE2(x, y), remquo)(x, y, quo)
+#define rint(x) __TG_REAL(__TG_TYPE(x), rint)(x)
+#define round(x) __TG_REAL(__TG_TYPE(x), round)(x)
+#define scalbn(x, n) __TG_REAL(__TG_TYPE(x), scalbn)(x, n)
+#define scalbln(x, n) __TG_REAL(__TG_TYPE(x), scalbln)(x, n)
+#define tgamma(x) __TG_REAL(__TG_TYPE(x), tgamma)(x)
+#define trunc(x) __TG_REAL(__TG_TYPE(x), trunc)(x)
+
+
+/*
+
+  Functions with only complex versions
+
+*/
+#define carg(z) __TG_COMPLEX(__TG_TYPE(z), carg)(z)
+#define cimag(z) __TG_COMPLEX(__TG_TYPE(z), cimag)(z)
+#define conj(z) __TG_COMPLEX(__TG_TYPE(z), conj)(z)
+#define cproj(z) __TG_COMPLEX(__TG_TYPE(z), cproj)(z)
+#define creal(z) __TG_COMPLEX(__TG_TYPE(z), creal)(z)
+
+
+/*
+
+  Not part of C17: the half-turn functions of math.h's extensions, which have
+  float and double versions only. A long double argument calls the double
+  version.
+
+*/
+#define __TG_HALF_TURN(t, fn) _Generic((t), \
+  float: fn##f, \
+  default: fn)
+
+#define sinpi(t) __TG_HALF_TURN(__TG_TYPE(t), sinpi)(t)
+#define cospi(t) __TG_HALF_TURN(__TG_TYPE(t), cospi)(t)
+#define tanpi(t) __TG_HALF_TURN(__TG_TYPE(t), tanpi)(t)
+
+#endif
@@ -0,0 +1,56 @@
+/*
+
+  CexpKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CEXPKERNEL_C
+#define COMPLEX_CEXPKERNEL_C
+
+#include "complex.h"
+#include "math.h"
+#include "complex/ComplexParts.c"
+
+/*
+
+  cexp of an infinite or NaN part, as Annex G.6.3.1 has it. e^x of an infinite
+  x is zero or infinite in the direction of y, and of a NaN x NaN, except that
+  a zero y stays the imaginary part. An infinite or NaN y makes both parts NaN
+  (raising invalid if it is infinite), except the real part of e^(+inf) stays
+  infinite and both parts of e^(-inf) are zero.
+
+*/
+static double complex cexpSpecial(double x, double y){
+  // A zero y goes with an infinite or NaN x, as the others are all finite
+  if(y == 0) return CMPLX(x == -HUGE_VAL ? 0 : x + x, y);
+
+  if(__builtin_isinf(x)){
+    double ex = x > 0 ? x : 0;
+    if(y - y != 0) return CMPLX(ex, x > 0 ? y - y : 0);
+    double c, s;
+    cis(y, &c, &s);
+    return CMPLX(ex*c, ex*s);
+  }
+
+  return CMPLX(x + (y - y), x + (y - y));
+}
+
+
+
+// Body of cexp, shared with cpow
+static inline double complex cexpCore(double x, double y){
+  if(!__builtin_isfinite(x) || !__builtin_isfinite(y)){
+    return cexpSpecial(x, y);
+  }
+
+  double c, s, re, im;
+  cis(y, &c, &s);
+  expTimes(x, c, s, &re, &im);
+  return CMPLX(re, im);
+}
+
+#endif
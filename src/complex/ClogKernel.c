@@ -0,0 +1,70 @@
+/*
+
+  ClogKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CLOGKERNEL_C
+#define COMPLEX_CLOGKERNEL_C
+
+#include "complex.h"
+#include "math.h"
+#include "math/AtanKernel.c"
+#include "math/LogKernel.c"
+#include "math/HypotKernel.c"
+
+/*
+
+  Stores log|z| and arg z for z = x + i*y, both finite and not both zero.
+
+  log|z| is log(x^2 + y^2)/2, with x and y scaled by 2^-e so their squares
+  can't overflow or underflow, and the sum of squares formed exactly as
+  s + lo. Then log(x^2 + y^2) = 2e*log(2) + log(s) + lo/s, and the low part
+  goes in as the log kernel's tail. Near |z| = 1, where the result cancels
+  down to a few bits, those are the bits that count.
+
+*/
+static inline void clogParts(double x, double y, double *re, double *im){
+  double a, b, up, lo, f;
+  double e = hypotScale(x, y, &a, &b, &up);
+  double s = sumSquares(a, b, &lo);
+  double k = logReduce(s, &f);
+
+  *re = 0.5*logKernel(k + 2*e, f, lo/s);
+  *im = atan2Kernel(y, x);
+}
+
+
+/*
+
+  clog of an infinite or NaN part, or of zero, as Annex G.6.3.2 has it. The
+  imaginary part is atan2(y, x) for all of them. The real part is +inf if
+  either part is infinite, NaN if either is NaN, and -inf for zero, raising
+  divide-by-zero.
+
+*/
+static double complex clogSpecial(double x, double y){
+  double re = __builtin_isinf(x) || __builtin_isinf(y) ? HUGE_VAL
+            : x != x || y != y ? x + y
+            : -1/__builtin_fabs(x);
+  return CMPLX(re, atan2Core(y, x));
+}
+
+
+
+// Body of clog, shared with cpow
+static inline double complex clogCore(double x, double y){
+  if(!__builtin_isfinite(x) || !__builtin_isfinite(y) || (x == 0 && y == 0)){
+    return clogSpecial(x, y);
+  }
+
+  double re, im;
+  clogParts(x, y, &re, &im);
+  return CMPLX(re, im);
+}
+
+#endif
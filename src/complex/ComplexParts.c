@@ -0,0 +1,102 @@
+/*
+
+  ComplexParts.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_COMPLEXPARTS_C
+#define COMPLEX_COMPLEXPARTS_C
+
+#include "complex.h"
+#include "math.h"
+#include "math/TrigReduce.c"
+#include "math/SincosKernel.c"
+#include "math/ExpKernel.c"
+
+
+/*
+
+  Stores cos(y) and sin(y) for finite y, from one reduction of y and the fused
+  kernel of sincos, without sincos's checks for infinities and NaNs (and its
+  errno)
+
+*/
+static inline void cis(double y, double *c, double *s){
+  double y0, y1;
+  int n = trigReduce(y, &y0, &y1);
+  sincosQuadrant(n, y0, y1, s, c);
+}
+
+
+/*
+
+  Stores e^x*c and e^x*s, for cexp's real and imaginary parts. The cosine and
+  sine are multiplied in after the first of expSplit's scales, which is as
+  late as it can be with p still finite, and as early as it can be with a
+  subnormal sine not rounded before it is scaled up. So parts that are finite
+  come out finite, however large e^x.
+
+*/
+static inline void expTimes(double x, double c, double s, double *ec,
+                            double *es){
+  double scale[3];
+  double p = expSplit(x, scale)*scale[0];
+  *ec = p*c*scale[1]*scale[2];
+  *es = p*s*scale[1]*scale[2];
+}
+
+
+/*
+
+  Stores cosh(a)*u and sinh(a)*v, for the parts of the complex sine and
+  cosine (which are sin x*cosh y + i*cos x*sinh y and
+  cos x*cosh y - i*sin x*sinh y).
+
+  Both come from one reduction of t = |a|. Up to COSH_LARGE they are built
+  from e^t - 1, as cosh(t) = 1 + (e^t-1)^2/(2e^t) and
+  sinh(t) = ((e^t-1) + (e^t-1)/e^t)/2, which keeps sinh accurate near zero,
+  with e^t - 1 carried to more than double precision.
+  Past it e^-t is lost next to e^t, and both are e^t/2, which is multiplied
+  into u and v between its scales like in expTimes. Both ways are computed and
+  one picked with selects, so loops calling this vectorize.
+
+*/
+#define COSH_LARGE 22.0
+
+static inline void coshSinhTimes(double a, double u, double v, double *coshu,
+                                 double *sinhv){
+  double t = expClamp(__builtin_fabs(a));
+  int large = __builtin_isgreater(t, COSH_LARGE);
+
+  double kd, tail, lo;
+  double hi = expReduce(t, &kd, &tail);
+
+  // 2^k is only used here below COSH_LARGE, where it is 2^32 at most
+  double scale = selectDouble(large, 1, expScale(kd));
+  double em1 = expm1Parts(hi, tail, scale, &lo);
+
+  // (e^t-1)/e^t, carrying the low parts of e^t-1 and of e^t = em1 + 1
+  double e = em1 + 1;
+  double elo = sumError(em1, 1, e) + lo;
+  double ratio = em1/e;
+  ratio += MULADD(-ratio, elo, lo)/e;
+
+  double coshSmall = MULADD(0.5*em1, ratio, MULADD(0.5*lo, ratio, 1));
+  double sinhSmall = 0.5*(em1 + (ratio + lo));
+
+  double scales[3];
+  expScales(kd, scales);
+  double half = 0.5*(1 + (hi + tail))*scales[0];
+
+  double cu = selectDouble(large, half*u*scales[1]*scales[2], u*coshSmall);
+  double sv = selectDouble(large, half*v*scales[1]*scales[2], v*sinhSmall);
+
+  *coshu = cu;
+  *sinhv = __builtin_copysign(1, a)*sv;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+
+  CoshSinh.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_COSHSINH_C
+#define COMPLEX_COSHSINH_C
+
+#include "complex.h"
+#include "math.h"
+#include "complex/ComplexParts.c"
+
+
+/*
+
+  Returns ccosh(a + i*b) (with hyperbolic 0) or csinh(a + i*b) (with 1), from
+  which the complex cosine and sine follow as ccos(z) = ccosh(i*z) and
+  csin(z) = -i*csinh(i*z).
+
+  Everything finite goes through coshSinhTimes. The infinities and NaNs are
+  those of Annex G.6.2.4 and G.6.2.5: an infinite a with a finite nonzero b is
+  an infinity in the direction of b, and a zero b is kept as the imaginary
+  part, signed as the formulas would sign it. The rest are NaN, raising
+  invalid for an infinite b, except that a zero a stays zero in the part
+  multiplied by sinh(a), and an infinite a stays infinite in the real part.
+
+*/
+static double complex coshSinh(double a, double b, int hyperbolic){
+  if(__builtin_isfinite(a) && __builtin_isfinite(b)){
+    double c, s, re, im;
+    cis(b, &c, &s);
+    if(hyperbolic) coshSinhTimes(a, s, c, &im, &re);
+    else coshSinhTimes(a, c, s, &re, &im);
+    return CMPLX(re, im);
+  }
+
+  double ch = __builtin_fabs(a), sh = a;
+
+  if(b == 0){
+    if(hyperbolic) return CMPLX(sh, b);
+    return CMPLX(ch, __builtin_copysign(1, a)*b);
+  }
+
+  if(__builtin_isinf(a)){
+    if(b - b != 0) return CMPLX(hyperbolic ? sh : ch, b - b);
+    double c, s;
+    cis(b, &c, &s);
+    if(hyperbolic) return CMPLX(sh*c, ch*s);
+    return CMPLX(ch*c, sh*s);
+  }
+
+  if(a == 0){
+    if(hyperbolic) return CMPLX(a, b - b);
+    return CMPLX(b - b, a);
+  }
+
+  return CMPLX(a + (b - b), a + (b - b));
+}
+
+#endif
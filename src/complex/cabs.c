@@ -0,0 +1,38 @@
+/*
+
+  cabs.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CABS_C
+#define COMPLEX_CABS_C
+
+#include "complex.h"
+#include "math.h"
+#include "math/HypotKernel.c"
+
+
+/*
+
+  Returns |z|, hypot(x, y) for z = x + i*y, but without errno.
+
+  The parts are scaled by a power of 2 before squaring, so nothing overflows
+  or underflows unless the result does, and the square root is corrected for
+  the rounding of the sum of squares. An infinite part makes the result
+  infinite, even if the other is a NaN.
+
+*/
+double cabs(double complex z){
+  double x = __real__ z, y = __imag__ z;
+
+  if(__builtin_isinf(x) || __builtin_isinf(y)) return HUGE_VAL;
+  if(x != x || y != y) return x + y;
+
+  return hypotKernel(x, y);
+}
+
+#endif
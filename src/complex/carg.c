@@ -0,0 +1,28 @@
+/*
+
+  carg.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CARG_C
+#define COMPLEX_CARG_C
+
+#include "complex.h"
+#include "math.h"
+#include "math/AtanKernel.c"
+
+
+/*
+
+  Returns the argument of z, atan2(y, x) for z = x + i*y, in [-pi,pi]
+
+*/
+double carg(double complex z){
+  return atan2Core(__imag__ z, __real__ z);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/*
+
+  ccos.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CCOS_C
+#define COMPLEX_CCOS_C
+
+#include "complex.h"
+#include "complex/CoshSinh.c"
+
+
+/*
+
+  Returns the complex cosine of z, cos x*cosh y - i*sin x*sinh y for
+  z = x + i*y.
+
+  It is computed as ccosh(i*z), which is how Annex G defines its special
+  cases. sin x and cos x come from one reduction of x, cosh y and sinh y from
+  one exponential.
+
+*/
+double complex ccos(double complex z){
+  return coshSinh(-__imag__ z, __real__ z, 0);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/*
+
+  cexp.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CEXP_C
+#define COMPLEX_CEXP_C
+
+#include "complex.h"
+#include "complex/CexpKernel.c"
+
+
+/*
+
+  Returns the complex base-e exponential of z, e^x*(cos y + i*sin y) for
+  z = x + i*y.
+
+  The cosine and sine come from one reduction of y, and are multiplied into
+  e^x before it is scaled, so a part that is finite isn't lost to e^x being
+  infinite (or zero) on its own.
+
+*/
+double complex cexp(double complex z){
+  return cexpCore(__real__ z, __imag__ z);
+}
+
+#endif
@@ -0,0 +1,28 @@
+/*
+
+  clog.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CLOG_C
+#define COMPLEX_CLOG_C
+
+#include "complex.h"
+#include "complex/ClogKernel.c"
+
+
+/*
+
+  Returns the complex natural logarithm of z, log|z| + i*arg z, with the
+  branch cut along the negative real axis
+
+*/
+double complex clog(double complex z){
+  return clogCore(__real__ z, __imag__ z);
+}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+
+  complex_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_COMPLEX_BATCH_C
+#define COMPLEX_COMPLEX_BATCH_C
+
+#include "complex.h"
+#include "math.h"
+#include <stddef.h>
+#include "math/SincosBlock.c"
+#include "math/Exponent.c"
+#include "math/FlushSubnormals.c"
+#include "math/AtanKernel.c"
+#include "math/HypotKernel.c"
+#include "complex/CexpKernel.c"
+#include "complex/CoshSinh.c"
+#include "complex/ClogKernel.c"
+
+
+/*
+
+  Each function below works through its array a block of SINCOS_BLOCK
+  elements at a time. The block is split into arrays of real and imaginary
+  parts, the sines and cosines computed by sincosBlock (so with MATH_STATS they
+  are counted as sincos_batch's), and then every element goes through the
+  same branch-free kernels as the scalar functions, in a loop that vectorizes.
+
+  Elements with an infinite or NaN part (and zeros, where the logarithm and
+  argument need them) are noted on the way and redone one at a time afterwards,
+  with the scalar functions' special cases, for the values of Annex G.
+  Everything is read into the block before anything is written, so the output
+  may be the input array.
+
+*/
+static inline int complexSpecial(double x, double y){
+  return (doubleExponent(x) == 0x7ff) | (doubleExponent(y) == 0x7ff);
+}
+
+static inline void complexSplit(const double complex *z, double *x, double *y,
+                                size_t count){
+  for(size_t j = 0; j < count; j++){
+    x[j] = __real__ z[j];
+    y[j] = __imag__ z[j];
+  }
+}
+
+
+void cexp_batch(const double complex *z, double complex *w, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK], s[SINCOS_BLOCK], c[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+    sincosBlock(y, s, c, count);
+
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      double re, im;
+      expTimes(x[j], c[j], s[j], &re, &im);
+      __real__ w[i+j] = re;
+      __imag__ w[i+j] = im;
+      slow |= complexSpecial(x[j], y[j]);
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(complexSpecial(x[j], y[j])) w[i+j] = cexpSpecial(x[j], y[j]);
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+void csin_batch(const double complex *z, double complex *w, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK], s[SINCOS_BLOCK], c[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+    sincosBlock(x, s, c, count);
+
+    // sin x*cosh y + i*cos x*sinh y
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      double re, im;
+      coshSinhTimes(y[j], s[j], c[j], &re, &im);
+      __real__ w[i+j] = re;
+      __imag__ w[i+j] = im;
+      slow |= complexSpecial(x[j], y[j]);
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(!complexSpecial(x[j], y[j])) continue;
+        double complex v = coshSinh(-y[j], x[j], 1);
+        w[i+j] = CMPLX(__imag__ v, -__real__ v);
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+void ccos_batch(const double complex *z, double complex *w, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK], s[SINCOS_BLOCK], c[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+    sincosBlock(x, s, c, count);
+
+    // cos x*cosh y - i*sin x*sinh y, as cos x*cosh(-y) + i*sin x*sinh(-y)
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      double re, im;
+      coshSinhTimes(-y[j], c[j], s[j], &re, &im);
+      __real__ w[i+j] = re;
+      __imag__ w[i+j] = im;
+      slow |= complexSpecial(x[j], y[j]);
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(complexSpecial(x[j], y[j])) w[i+j] = coshSinh(-y[j], x[j], 0);
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+void clog_batch(const double complex *z, double complex *w, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      double re, im;
+      clogParts(x[j], y[j], &re, &im);
+      __real__ w[i+j] = re;
+      __imag__ w[i+j] = im;
+      slow |= complexSpecial(x[j], y[j]) | ((x[j] == 0) & (y[j] == 0));
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(complexSpecial(x[j], y[j]) || (x[j] == 0 && y[j] == 0)){
+          w[i+j] = clogSpecial(x[j], y[j]);
+        }
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+/*
+
+  cabs_batch vectorizes only where squareRoot does (see Sqrt.c), which with
+  math errno on is nowhere: then the square roots are taken one at a time, and
+  the rest of the loop with them.
+
+*/
+void cabs_batch(const double complex *z, double *r, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      r[i+j] = hypotKernel(x[j], y[j]);
+      slow |= complexSpecial(x[j], y[j]);
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(!complexSpecial(x[j], y[j])) continue;
+        // As in cabs, an infinite part makes the result infinite
+        r[i+j] = __builtin_isinf(x[j]) || __builtin_isinf(y[j]) ? HUGE_VAL
+               : x[j] + y[j];
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+void carg_batch(const double complex *z, double *r, size_t n){
+  double x[SINCOS_BLOCK], y[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    complexSplit(z+i, x, y, count);
+
+    int slow = 0;
+    for(size_t j = 0; j < count; j++){
+      r[i+j] = atan2Kernel(y[j], x[j]);
+      slow |= complexSpecial(x[j], y[j]) | ((x[j] == 0) & (y[j] == 0));
+    }
+
+    if(slow){
+      for(size_t j = 0; j < count; j++){
+        if(complexSpecial(x[j], y[j]) || (x[j] == 0 && y[j] == 0)){
+          r[i+j] = atan2Core(y[j], x[j]);
+        }
+      }
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+#endif
@@ -0,0 +1,60 @@
+/*
+
+  cpow.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CPOW_C
+#define COMPLEX_CPOW_C
+
+#include "complex.h"
+#include "complex/CexpKernel.c"
+#include "complex/ClogKernel.c"
+
+
+/*
+
+  Returns x^y, computed as cexp(y*clog(x)), which puts the branch cut along
+  the negative real axis of x.
+
+  The product is written out rather than left to complex multiplication, which
+  would call the compiler's runtime multiply, with its infinity and NaN
+  recovery.
+  Terms with a zero part of y are left out, so that a real y doesn't meet the
+  infinite log of zero in a 0*inf. 0^y is 1 for y = 0 and 0 when y's real part
+  is positive, the limits along the real axis; the formula would give NaNs.
+
+  The accuracy is limited by the rounding of the product and of clog's parts.
+  An error in the real part re becomes a relative error of the result as large
+  as itself, so a large result loses about log2|re| bits.
+
+*/
+double complex cpow(double complex x, double complex y){
+  double yr = __real__ y, yi = __imag__ y;
+
+  if(__real__ x == 0 && __imag__ x == 0){
+    if(yr == 0 && yi == 0) return CMPLX(1, 0);
+    if(yr > 0) return CMPLX(0, 0);
+  }
+
+  double complex l = clogCore(__real__ x, __imag__ x);
+  double lr = __real__ l, li = __imag__ l;
+
+  double re = 0, im = 0;
+  if(yr != 0){
+    re = yr*lr;
+    im = yr*li;
+  }
+  if(yi != 0){
+    re -= yi*li;
+    im += yi*lr;
+  }
+
+  return cexpCore(re, im);
+}
+
+#endif
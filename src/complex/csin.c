@@ -0,0 +1,33 @@
+/*
+
+  csin.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef COMPLEX_CSIN_C
+#define COMPLEX_CSIN_C
+
+#include "complex.h"
+#include "complex/CoshSinh.c"
+
+
+/*
+
+  Returns the complex sine of z, sin x*cosh y + i*cos x*sinh y for
+  z = x + i*y.
+
+  It is computed as -i*csinh(i*z), which is how Annex G defines its special
+  cases. sin x and cos x come from one reduction of x, cosh y and sinh y from
+  one exponential.
+
+*/
+double complex csin(double complex z){
+  double complex w = coshSinh(-__imag__ z, __real__ z, 1);
+  return CMPLX(__imag__ w, -__real__ w);
+}
+
+#endif
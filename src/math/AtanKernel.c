@@ -0,0 +1,122 @@
+/*
+
+  AtanKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_ATANKERNEL_C
+#define MATH_ATANKERNEL_C
+
+#include "math.h"
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+#include "math/DoubleDouble.c"
+#include "math/ElementaryPoly.c"
+
+
+/*
+
+  pi/4 split in two. The high part has 50 significant bits, so multiplying it
+  by 0 to 4 is exact.
+
+*/
+#define ATAN_PIO4_HI 0x1.921fb54442d18p-1
+#define ATAN_PIO4_LO 3.06161699786838301793e-17
+
+// tan(pi/8) = sqrt(2) - 1, where the reduction switches over
+#define ATAN_TAN_PIO8 0x1.a827999fcef32p-2
+
+
+/*
+
+  Returns atan2(y, x) for finite x and y that aren't both zero.
+
+  The angle is that of the point (|x|,|y|), folded into [0,pi/4] by swapping
+  the two when |y| is the larger, and then atan(t) of t = num/den, the smaller
+  over the larger. Past tan(pi/8) it is pi/4 + atan(u) instead, with
+  u = (num-den)/(num+den), so that the polynomial only sees [-tan(pi/8),
+  tan(pi/8)]. Both quotients are formed as a rounded u plus its exact
+  remainder, and the remainder is carried through to the end as a tail, so
+  the rounding of the division costs nothing.
+
+  Unfolding is a multiple q of pi/4 plus or minus the folded angle: pi/2 minus
+  it if swapped, pi minus that if x is negative, then the sign of y.
+
+  The branches are all selects, so loops calling this vectorize.
+
+*/
+static inline double atan2Kernel(double y, double x){
+  double ax = __builtin_fabs(x), ay = __builtin_fabs(y);
+  int swap = __builtin_isgreater(ay, ax);
+  double num = selectDouble(swap, ax, ay);
+  double den = selectDouble(swap, ay, ax);
+
+  // Kept away from the ends of the range, so num+den and the remainders fit
+  double scale = selectDouble(__builtin_isgreater(den, 0x1p960), 0x1p-60, 1);
+  scale = selectDouble(__builtin_isless(den, 0x1p-900), 0x1p200, scale);
+  num *= scale;
+  den *= scale;
+
+  // The quotient a/b, with the low parts al and bl of a and b exact
+  int big = __builtin_isgreater(num, ATAN_TAN_PIO8*den);
+  double dh = num - den, sh = num + den;
+  double a = selectDouble(big, dh, num);
+  double b = selectDouble(big, sh, den);
+  double al = selectDouble(big, addError(-den, num, dh), 0);
+  double bl = selectDouble(big, addError(den, num, sh), 0);
+
+  double u = a/b;
+  double p = u*b;
+  double ul = (((a - p) - mulError(u, b, p)) + MULADD(-u, bl, al))/b;
+
+  // Unless num is so small the remainder underflows, and u is below 2^-60
+  ul = selectDouble(__builtin_isgreater(num, 0x1p-960), ul, 0);
+
+  // atan(u+ul) = u + u^3*P(u^2) + ul/(1+u^2)
+  double z = u*u;
+  double tail = MULADD(u*z, polynomial(z, ATAN_POLY, 12), MULADD(-ul, z, ul));
+
+  // The sign bit, as __builtin_signbit doesn't vectorize
+  int negative = doubleToBits(x) >> 63;
+
+  double q = selectDouble(big, 1, 0);
+  q = selectDouble(swap, 2 - q, q);
+  q = selectDouble(negative, 4 - q, q);
+  double sigma = selectDouble(swap ^ negative, -1, 1);
+
+  // q*pi/4 + sigma*u is added exactly, and everything small to its low part
+  double hi = q*ATAN_PIO4_HI, su = sigma*u;
+  double v = hi + su;
+  double lo = addError(hi, su, v) + MULADD(sigma, tail, q*ATAN_PIO4_LO);
+
+  return __builtin_copysign(v + lo, y);
+}
+
+
+/*
+
+  atan2 of any y and x. Infinities and zeros go through the kernel as finite
+  points at the same angle: each infinite coordinate becomes 1 and each finite
+  one 0 (keeping signs), and (0, 0) becomes (1, 0), or (-1, 0) for x = -0.
+  NaNs come back as NaN.
+
+*/
+static inline double atan2Core(double y, double x){
+  if(x != x || y != y) return x + y;
+
+  if(__builtin_isinf(x) || __builtin_isinf(y)){
+    x = __builtin_copysign(__builtin_isinf(x) ? 1 : 0, x);
+    y = __builtin_copysign(__builtin_isinf(y) ? 1 : 0, y);
+  }else if(x == 0 && y == 0){
+    x = __builtin_copysign(1, x);
+  }
+
+  return atan2Kernel(y, x);
+}
+
+#endif
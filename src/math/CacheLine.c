@@ -0,0 +1,40 @@
+/*
+
+  CacheLine.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_CACHELINE_C
+#define MATH_CACHELINE_C
+
+
+/*
+
+  Size of a cache line on the targets that matter (x86 and most ARM cores)
+
+*/
+#define CACHE_LINE 64
+
+
+/*
+
+  Every table the kernels read is static const, filled in by the compiler, so
+  it lives in .rodata with nothing to initialize at run time and nothing any
+  thread ever writes. Aligning the tables to a cache line as well keeps each
+  one in as few lines as it can fit in, so a call touches the fewest lines
+  possible, however many threads are calling at once.
+
+    static const double TABLE[n] CACHE_ALIGNED = { ... };
+
+*/
+#if defined(__GNUC__)
+  #define CACHE_ALIGNED __attribute__((aligned(CACHE_LINE)))
+#else
+  #define CACHE_ALIGNED _Alignas(CACHE_LINE)
+#endif
+
+#endif
@@ -0,0 +1,57 @@
+/*
+
+  CosKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_COSKERNEL_C
+#define MATH_COSKERNEL_C
+
+#include "math.h"
+#include "math/CacheLine.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+
+
+/*
+
+  Minimax coefficients for
+  cos(x) = 1 - x^2/2 + x^4*(C[0] + C[1]*x^2 + ... + C[5]*x^10)
+  on [-pi/4,pi/4], with an error under 2^-58 (from fdlibm)
+
+*/
+static const double COS_POLY[6] CACHE_ALIGNED = {
+   4.16666666666666019037e-02,
+  -1.38888888888741095749e-03,
+   2.48015872894767294178e-05,
+  -2.75573143513906633035e-07,
+   2.08757232129817482790e-09,
+  -1.13596475577881948265e-11
+};
+
+
+/*
+
+  Returns cos(x+y) for |x+y| <= pi/4, where y is the tail left over by range
+  reduction (pass 0 if there is none).
+
+  The leading 1 - x^2/2 is added last and its rounding error is recovered,
+  since that is where most of the error would come from.
+
+  The tail only matters to first order: cos(x+y) ~ cos(x) - x*y
+
+*/
+static inline double cosKernel(double x, double y){
+  double z = x*x;
+  double r = z*polynomial(z, COS_POLY, 6);
+
+  double hz = 0.5*z;
+  double w = 1.0-hz;
+  return w + (((1.0-w)-hz) + MULADD(z, r, -x*y));
+}
+
+#endif
@@ -0,0 +1,61 @@
+/*
+
+  DoubleDouble.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_DOUBLEDOUBLE_C
+#define MATH_DOUBLEDOUBLE_C
+
+#include "math.h"
+
+
+/*
+
+  Returns a*b - p exactly, where p is a*b rounded, so that p plus the result is
+  the exact product. Holds as long as a*b doesn't overflow and the result
+  doesn't underflow.
+
+  With a fused multiply-add it is one instruction. Without one, a and b are
+  split into halves of 26 bits (Veltkamp splitting, as in fma.c), whose
+  products are all exact, and the error is summed from those (Dekker).
+
+*/
+static inline double mulError(double a, double b, double p){
+#ifdef FP_FAST_FMA
+  return __builtin_fma(a, b, -p);
+#else
+  double ta = 134217729.0*a, tb = 134217729.0*b;
+  double ah = ta - (ta - a), bh = tb - (tb - b);
+  double al = a - ah, bl = b - bh;
+  return ((ah*bh - p) + ah*bl + al*bh) + al*bl;
+#endif
+}
+
+
+/*
+
+  Returns the part of a+b that doesn't fit in s, the sum rounded, given that
+  |a| >= |b| (or a is zero). s plus the result is then a+b exactly.
+
+*/
+static inline double addError(double a, double b, double s){
+  return b - (s - a);
+}
+
+
+/*
+
+  Same for any a and b, at a few more operations (Knuth)
+
+*/
+static inline double sumError(double a, double b, double s){
+  double bb = s - a;
+  return (a - (s - bb)) + (b - bb);
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+
+  ElementaryPoly.c
+
+  Generated by tools/remez.c, do not edit. To regenerate:
+
+    remez src/math/ElementaryPoly.c \
+      EXP_POLY=expm1,11,-0.3466,0.3466,double \
+      LOG_POLY=log,7,-0.1716,0.1716,double \
+      ATAN_POLY=atan,12,-0.4143,0.4143,double
+
+*/
+
+#ifndef MATH_ELEMENTARYPOLY_C
+#define MATH_ELEMENTARYPOLY_C
+
+#include "math/CacheLine.c"
+
+
+/*
+
+  exp(x) = 1 + x + x^2*P(x) on [-0.3466,0.3466],
+  relative error at most 2^-61.4
+
+*/
+static const double EXP_POLY[11] CACHE_ALIGNED = {
+   0x1p-1,
+   0x1.5555555555557p-3,
+   0x1.555555555555cp-5,
+   0x1.11111111102d5p-7,
+   0x1.6c16c16c12bc6p-10,
+   0x1.a01a01aa8f832p-13,
+   0x1.a01a01bc0577ap-16,
+   0x1.71de067bf010bp-19,
+   0x1.27e4ab76b7a53p-22,
+   0x1.af457967c7a91p-26,
+   0x1.1fba8f3236968p-29
+};
+
+#define EXP_POLY_ERROR 0x1.cp-62
+
+
+/*
+
+  log(1+f) = 2s + s^3*P(s^2), s = f/(2+f) on [-0.1716,0.1716],
+  relative error at most 2^-59.5
+
+*/
+static const double LOG_POLY[7] CACHE_ALIGNED = {
+   0x1.5555555555592p-1,
+   0x1.999999997ff1bp-2,
+   0x1.24924941e1cecp-2,
+   0x1.c71c521343db7p-3,
+   0x1.74663d4b41045p-3,
+   0x1.39a1db565dbf7p-3,
+   0x1.2f0469be80168p-3
+};
+
+#define LOG_POLY_ERROR 0x1.8p-60
+
+
+/*
+
+  atan(x) = x + x^3*P(x^2) on [-0.4143,0.4143],
+  relative error at most 2^-60.8
+
+*/
+static const double ATAN_POLY[12] CACHE_ALIGNED = {
+  -0x1.5555555555555p-2,
+   0x1.9999999999868p-3,
+  -0x1.24924924864dfp-3,
+   0x1.c71c71bea43acp-4,
+  -0x1.745d158e7dd4p-4,
+   0x1.3b137b9ad4a8bp-4,
+  -0x1.110ce886ed5c1p-4,
+   0x1.e1751c3cc1fd9p-5,
+  -0x1.ab6e556df2ef2p-5,
+   0x1.702d43f903ff8p-5,
+  -0x1.0f672647270f2p-5,
+   0x1.e295ac4c07a1dp-7
+};
+
+#define ATAN_POLY_ERROR 0x1.4p-61
+
+#endif
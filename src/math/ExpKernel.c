@@ -0,0 +1,161 @@
+/*
+
+  ExpKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_EXPKERNEL_C
+#define MATH_EXPKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+#include "math/DoubleDouble.c"
+#include "math/ElementaryPoly.c"
+
+
+/*
+
+  log(2) split in two so that k*EXP_LN2_HI is exact for |k| < 2^21, and
+  1/log(2) (from fdlibm)
+
+*/
+#define EXP_LN2_HI 6.93147180369123816490e-01
+#define EXP_LN2_LO 1.90821492927058770002e-10
+#define EXP_INV_LN2 1.44269504088896338700e+00
+
+// Added to a number under 2^51 in magnitude, leaves it rounded in the low bits
+#define EXP_ROUND 0x1.8p52
+
+/*
+
+  Arguments are clamped to [-EXP_CLAMP,EXP_CLAMP]. That is far enough past
+  where e^x over- or underflows that e^x times any nonzero double does too, and
+  near enough that 2^k splits into three normal powers of 2.
+
+*/
+#define EXP_CLAMP 2100.0
+
+
+/*
+
+  Splits x into k*log(2) + r, with k an integer and r in [-log(2)/2,log(2)/2],
+  and returns e^r - 1 as hi + tail, hi being exact and tail small next to it.
+  k comes back in kd, as k + EXP_ROUND, so that its bit pattern holds k in the
+  low bits.
+
+  hi = x - k*EXP_LN2_HI is exact, so the only rounding errors are in the tail,
+  which is the polynomial's r^2*P(r) less lo, and so no more than a fifth of
+  hi. The rounded r = hi - lo is only used in the polynomial.
+
+*/
+static inline double expReduce(double x, double *kd, double *tail){
+  *kd = MULADD(x, EXP_INV_LN2, EXP_ROUND);
+  double k = *kd - EXP_ROUND;
+
+  double hi = x - k*EXP_LN2_HI;
+  double lo = k*EXP_LN2_LO;
+  double r = hi - lo;
+
+  *tail = r*r*polynomial(r, EXP_POLY, 11) - lo;
+  return hi;
+}
+
+
+/*
+
+  2^k for the kd of expReduce (or any double of EXP_ROUND's magnitude holding
+  k in its low bits), for k in [-1022,1023]
+
+*/
+static inline double expScale(double kd){
+  return bitsToDouble((doubleToBits(kd) + 1023) << 52);
+}
+
+
+/*
+
+  Returns p and stores scale[] such that e^x = p*scale[0]*scale[1]*scale[2],
+  with p in [0.7,1.42] and the scales powers of 2 that are normal numbers, and
+  of the same sign of exponent. Multiplying p by them in that order over- or
+  underflows only if e^x does, and rounds just once if the result is
+  subnormal. Callers with something to multiply e^x by (the complex functions,
+  a cosine or a sine) multiply it in first, so that the product comes out
+  right even where e^x alone would be infinite or zero.
+
+  expScales splits the 2^k of expReduce's kd that way, for |k| up to that of
+  EXP_CLAMP, and expClamp clamps x to that range. NaN passes through the
+  clamps and the arithmetic as NaN. Everything is floating point arithmetic
+  and selects, so loops calling these vectorize.
+
+*/
+static inline void expScales(double kd, double scale[3]){
+  // k = k0 + k1 + k2, about a third each, each held in a rounding sum
+  double k = kd - EXP_ROUND;
+  double k0d = k*(1.0/3) + EXP_ROUND;
+  k -= k0d - EXP_ROUND;
+  double k1d = k*0.5 + EXP_ROUND;
+  double k2d = (k - (k1d - EXP_ROUND)) + EXP_ROUND;
+
+  scale[0] = expScale(k0d);
+  scale[1] = expScale(k1d);
+  scale[2] = expScale(k2d);
+}
+
+static inline double expClamp(double x){
+  x = selectDouble(__builtin_isgreater(x, EXP_CLAMP), EXP_CLAMP, x);
+  return selectDouble(__builtin_isless(x, -EXP_CLAMP), -EXP_CLAMP, x);
+}
+
+static inline double expSplit(double x, double scale[3]){
+  double kd, tail;
+  double hi = expReduce(expClamp(x), &kd, &tail);
+  expScales(kd, scale);
+  return 1 + (hi + tail);
+}
+
+static inline double expKernel(double x){
+  double scale[3];
+  double p = expSplit(x, scale);
+  return p*scale[0]*scale[1]*scale[2];
+}
+
+
+/*
+
+  Returns e^x - 1 for |x| <= EXPM1_MAX, for hyperbolic functions of small
+  arguments.
+
+  With expReduce's hi + tail = e^r - 1, e^x - 1 = (2^k - 1) + 2^k*(hi + tail).
+  2^k - 1 and 2^k*hi are exact for the k this range gives, and summed exactly,
+  so there is no cancellation, and near zero, where k is 0, the result is
+  hi + tail itself. expm1Parts takes the pieces from expReduce (and 2^k) and
+  returns the sum with what its rounding lost in lo, for callers that need
+  more than double precision.
+
+*/
+#define EXPM1_MAX 36.0
+
+static inline double expm1Parts(double hi, double tail, double scale,
+                                double *lo){
+  double a = scale - 1, b = scale*hi;
+  double s = a + b;
+  double e = sumError(a, b, s) + scale*tail;
+  double r = s + e;
+  *lo = addError(s, e, r);
+  return r;
+}
+
+static inline double expm1Kernel(double x){
+  double kd, tail, lo;
+  double hi = expReduce(x, &kd, &tail);
+  return expm1Parts(hi, tail, expScale(kd), &lo) + lo;
+}
+
+#endif
@@ -0,0 +1,447 @@
+/*
+
+  Exponent.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_EXPONENT_C
+#define MATH_EXPONENT_C
+
+#include "math.h"
+#include <float.h>
+#include <limits.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+
+
+/*
+
+  Reading or replacing the exponent of a normal number is a couple of integer
+  operations on its bit pattern. Zeros, subnormals, infinities and NaNs are
+  the only arguments needing more than that, and they are rare, so their code
+  is kept out of line where it doesn't get in the way of inlining the common
+  case into every caller.
+
+*/
+#ifdef __GNUC__
+  #define EXPONENT_SLOW __attribute__((noinline, cold))
+#else
+  #define EXPONENT_SLOW
+#endif
+
+#define DOUBLE_EXPONENT 0x7ff0000000000000u
+#define FLOAT_EXPONENT 0x7f800000u
+
+
+/*
+
+  Biased exponent field of x, and whether x is a normal number (not zero,
+  subnormal, infinite or NaN)
+
+*/
+static inline uint64_t doubleExponent(double x){
+  return doubleToBits(x) >> 52 & 0x7ff;
+}
+
+static inline int doubleIsNormal(double x){
+  return doubleExponent(x) - 1 < 0x7fe;
+}
+
+static inline uint32_t floatExponent(float x){
+  return floatToBits(x) >> 23 & 0xff;
+}
+
+static inline int floatIsNormal(float x){
+  return floatExponent(x) - 1 < 0xfe;
+}
+
+
+/*
+
+  Whether x*2^n is a normal number, given that x is one. Then it is exact, and
+  found by adding n to the exponent field.
+
+*/
+static inline int scaleStaysNormal(double x, int n){
+  return (uint64_t)((int64_t)doubleExponent(x) + n - 1) < 0x7fe;
+}
+
+static inline double scaleNormal(double x, int n){
+  return bitsToDouble(doubleToBits(x) + ((uint64_t)n << 52));
+}
+
+static inline int scaleStaysNormalf(float x, int n){
+  return (uint64_t)((int64_t)floatExponent(x) + n - 1) < 0xfe;
+}
+
+static inline float scaleNormalf(float x, int n){
+  return bitsToFloat(floatToBits(x) + ((uint32_t)n << 23));
+}
+
+
+/*
+
+  Returns x*2^n for everything else. Multiplying by powers of two is exact
+  unless the result overflows or becomes subnormal, so this only ever rounds
+  once.
+
+*/
+static EXPONENT_SLOW double scalbnSlow(double x, int n){
+  if(n > 1023){
+    x *= 0x1p1023;
+    n -= 1023;
+    if(n > 1023){
+      x *= 0x1p1023;
+      n -= 1023;
+      if(n > 1023) n = 1023;
+    }
+  }else if(n < -1022){
+    // Scale by 2^-969 (not 2^-1022) so the intermediate never rounds
+    x *= 0x1p-1022 * 0x1p53;
+    n += 1022-53;
+    if(n < -1022){
+      x *= 0x1p-1022 * 0x1p53;
+      n += 1022-53;
+      if(n < -1022) n = -1022;
+    }
+  }
+  return x * bitsToDouble((uint64_t)(0x3ff+n)<<52);
+}
+
+static EXPONENT_SLOW float scalbnSlowf(float x, int n){
+  if(n > 127){
+    x *= 0x1p127f;
+    n -= 127;
+    if(n > 127){
+      x *= 0x1p127f;
+      n -= 127;
+      if(n > 127) n = 127;
+    }
+  }else if(n < -126){
+    x *= 0x1p-126f * 0x1p24f;
+    n += 126-24;
+    if(n < -126){
+      x *= 0x1p-126f * 0x1p24f;
+      n += 126-24;
+      if(n < -126) n = -126;
+    }
+  }
+  return x * bitsToFloat((uint32_t)(0x7f+n)<<23);
+}
+
+
+/*
+
+  Returns x*2^n
+
+*/
+static inline double scalbnCore(double x, int n){
+  if(doubleIsNormal(x) && scaleStaysNormal(x, n)) return scaleNormal(x, n);
+  return scalbnSlow(x, n);
+}
+
+static inline float scalbnCoref(float x, int n){
+  if(floatIsNormal(x) && scaleStaysNormalf(x, n)) return scaleNormalf(x, n);
+  return scalbnSlowf(x, n);
+}
+
+
+/*
+
+  frexp of a normal number: the exponent field is swapped for that of 0.5
+
+*/
+static inline double frexpNormal(double x, int *exp){
+  uint64_t bits = doubleToBits(x);
+  *exp = (int)(bits >> 52 & 0x7ff) - 0x3fe;
+  return bitsToDouble((bits & ~DOUBLE_EXPONENT) | 0x3fe0000000000000);
+}
+
+static inline float frexpNormalf(float x, int *exp){
+  uint32_t bits = floatToBits(x);
+  *exp = (int)(bits >> 23 & 0xff) - 0x7e;
+  return bitsToFloat((bits & ~FLOAT_EXPONENT) | 0x3f000000);
+}
+
+
+/*
+
+  frexp of everything else. Zeros, infinities and NaNs come back as they are
+  with an exponent of 0, subnormals are scaled into the normal range first.
+
+*/
+static EXPONENT_SLOW double frexpSlow(double x, int *exp){
+  if(x == 0 || x - x != 0){
+    *exp = 0;
+    return x + x;
+  }
+  double m = frexpNormal(x*0x1p64, exp);
+  *exp -= 64;
+  return m;
+}
+
+static EXPONENT_SLOW float frexpSlowf(float x, int *exp){
+  if(x == 0 || x - x != 0){
+    *exp = 0;
+    return x + x;
+  }
+  float m = frexpNormalf(x*0x1p32f, exp);
+  *exp -= 32;
+  return m;
+}
+
+static inline double frexpCore(double x, int *exp){
+  if(doubleIsNormal(x)) return frexpNormal(x, exp);
+  return frexpSlow(x, exp);
+}
+
+static inline float frexpCoref(float x, int *exp){
+  if(floatIsNormal(x)) return frexpNormalf(x, exp);
+  return frexpSlowf(x, exp);
+}
+
+
+/*
+
+  ilogb of everything but normal numbers. The exponent of a subnormal is the
+  position of its leading one bit.
+
+*/
+static EXPONENT_SLOW int ilogbSlow(double x){
+  uint64_t bits = doubleToBits(x) << 1;
+  if(bits == 0) return FP_ILOGB0;
+  if(bits > DOUBLE_EXPONENT << 1) return FP_ILOGBNAN;
+  if(bits == DOUBLE_EXPONENT << 1) return INT_MAX;
+  return -0x3ff - __builtin_clzll(bits << 11);
+}
+
+static EXPONENT_SLOW int ilogbSlowf(float x){
+  uint32_t bits = floatToBits(x) << 1;
+  if(bits == 0) return FP_ILOGB0;
+  if(bits > FLOAT_EXPONENT << 1) return FP_ILOGBNAN;
+  if(bits == FLOAT_EXPONENT << 1) return INT_MAX;
+  return -0x7f - __builtin_clz(bits << 8);
+}
+
+static inline int ilogbCore(double x){
+  if(doubleIsNormal(x)) return (int)doubleExponent(x) - 0x3ff;
+  return ilogbSlow(x);
+}
+
+static inline int ilogbCoref(float x){
+  if(floatIsNormal(x)) return (int)floatExponent(x) - 0x7f;
+  return ilogbSlowf(x);
+}
+
+
+/*
+
+  logb of everything but normal numbers: -infinity for zero (dividing by zero
+  raises the divide-by-zero exception that goes with it), +infinity for
+  infinities, and NaN for NaN
+
+*/
+static EXPONENT_SLOW double logbSlow(double x){
+  if(x == 0) return -1/__builtin_fabs(x);
+  if(x - x != 0) return x*x;
+  return ilogbSlow(x);
+}
+
+static EXPONENT_SLOW float logbSlowf(float x){
+  if(x == 0) return -1/__builtin_fabsf(x);
+  if(x - x != 0) return x*x;
+  return ilogbSlowf(x);
+}
+
+static inline double logbCore(double x){
+  if(doubleIsNormal(x)) return (int)doubleExponent(x) - 0x3ff;
+  return logbSlow(x);
+}
+
+static inline float logbCoref(float x){
+  if(floatIsNormal(x)) return (int)floatExponent(x) - 0x7f;
+  return logbSlowf(x);
+}
+
+
+/*
+
+  Branch-free modf, shared with modf_batch.
+
+  Below 2^52, adding and subtracting 2^52 rounds |x| to a whole number, which
+  is one too big when it rounded up. That is the integral part, and |x| minus
+  it is the fractional part exactly. From 2^52 up (infinities and NaNs
+  included) x is its own integral part, and is swapped for zero before the
+  arithmetic so infinity minus infinity never raises an exception. (Masking
+  off the fraction bits would need a variable shift of 64 bit integers, which
+  loops don't vectorize with.)
+
+*/
+static inline double modfCore(double x, double *ip){
+  double a = __builtin_fabs(x);
+  uint64_t whole = !(a < 0x1p52);
+  a = selectDouble(whole, 0.0, a);
+
+  double t = (a + 0x1p52) - 0x1p52;
+  t = selectDouble(t > a, t - 1, t);
+  *ip = selectDouble(whole, x, __builtin_copysign(t, x));
+
+  // The fraction keeps the sign of x even when it is zero
+  double f = __builtin_copysign(a - t, x);
+  return selectDouble(x != x, x, f);
+}
+
+static inline float modfCoref(float x, float *ip){
+  float a = __builtin_fabsf(x);
+  uint32_t whole = !(a < 0x1p23f);
+  a = selectFloat(whole, 0.0f, a);
+
+  float t = (a + 0x1p23f) - 0x1p23f;
+  t = selectFloat(t > a, t - 1, t);
+  *ip = selectFloat(whole, x, __builtin_copysignf(t, x));
+
+  float f = __builtin_copysignf(a - t, x);
+  return selectFloat(x != x, x, f);
+}
+
+
+#if LDBL_MANT_DIG != DBL_MANT_DIG
+
+/*
+
+  Sign and biased exponent of a long double, which sit in the top 16 bits of
+  both the x87 format (with its 64 bit significand and explicit leading bit)
+  and IEEE binary128.
+
+*/
+#if LDBL_MANT_DIG == 64
+  union longDoubleBits {
+    long double f;
+    struct { uint64_t m; uint16_t se; } i;
+  };
+  #define LDBL_SE(u) ((u).i.se)
+  #define LDBL_SET_SE(u, v) ((u).i.se = (v))
+#else
+  union longDoubleBits {
+    long double f;
+    struct { uint64_t lo, hi; } i;
+  };
+  #define LDBL_SE(u) ((unsigned)((u).i.hi >> 48))
+  #define LDBL_SET_SE(u, v) \
+    ((u).i.hi = ((u).i.hi & 0x0000ffffffffffff) | (uint64_t)(v) << 48)
+#endif
+
+static inline unsigned longDoubleExponent(long double x){
+  union longDoubleBits u = { x };
+  return LDBL_SE(u) & 0x7fff;
+}
+
+static inline int longDoubleIsNormal(long double x){
+  return longDoubleExponent(x) - 1 < 0x7ffe;
+}
+
+// x with its biased exponent replaced by e, keeping the sign
+static inline long double withExponentl(long double x, unsigned e){
+  union longDoubleBits u = { x };
+  LDBL_SET_SE(u, (LDBL_SE(u) & 0x8000) | e);
+  return u.f;
+}
+
+
+/*
+
+  long double counterparts of scalbnSlow, frexpSlow and ilogbSlow. Subnormals
+  are scaled by 2^120 into the normal range instead of counting their leading
+  zeros, which doesn't depend on how the significand is laid out.
+
+*/
+static EXPONENT_SLOW long double scalbnSlowl(long double x, int n){
+  if(n > 16383){
+    x *= 0x1p16383L;
+    n -= 16383;
+    if(n > 16383){
+      x *= 0x1p16383L;
+      n -= 16383;
+      if(n > 16383) n = 16383;
+    }
+  }else if(n < -16382){
+    x *= LDBL_MIN * 0x1p113L;
+    n += 16382-113;
+    if(n < -16382){
+      x *= LDBL_MIN * 0x1p113L;
+      n += 16382-113;
+      if(n < -16382) n = -16382;
+    }
+  }
+  return x * withExponentl(1.0L, 0x3fff+n);
+}
+
+static EXPONENT_SLOW long double frexpSlowl(long double x, int *exp){
+  if(x == 0 || x - x != 0){
+    *exp = 0;
+    return x + x;
+  }
+  x *= 0x1p120L;
+  *exp = (int)longDoubleExponent(x) - 0x3ffe - 120;
+  return withExponentl(x, 0x3ffe);
+}
+
+static EXPONENT_SLOW int ilogbSlowl(long double x){
+  if(x == 0) return FP_ILOGB0;
+  if(x != x) return FP_ILOGBNAN;
+  if(x - x != 0) return INT_MAX;
+  return (int)longDoubleExponent(x*0x1p120L) - 0x3fff - 120;
+}
+
+static inline long double scalbnCorel(long double x, int n){
+  unsigned e = longDoubleExponent(x);
+  if(e - 1 < 0x7ffe && (uint64_t)((int64_t)e + n - 1) < 0x7ffe){
+    return withExponentl(x, e+n);
+  }
+  return scalbnSlowl(x, n);
+}
+
+static inline long double frexpCorel(long double x, int *exp){
+  if(!longDoubleIsNormal(x)) return frexpSlowl(x, exp);
+  *exp = (int)longDoubleExponent(x) - 0x3ffe;
+  return withExponentl(x, 0x3ffe);
+}
+
+static inline int ilogbCorel(long double x){
+  if(longDoubleIsNormal(x)) return (int)longDoubleExponent(x) - 0x3fff;
+  return ilogbSlowl(x);
+}
+
+
+/*
+
+  modf for long double, with the same rounding as modfCore. That needs no
+  knowledge of the significand's layout.
+
+*/
+static inline long double modfCorel(long double x, long double *ip){
+  const long double big = 1/LDBL_EPSILON;
+  long double a = __builtin_fabsl(x);
+
+  if(!(a < big)){
+    *ip = x;
+    return x != x ? x : __builtin_copysignl(0.0L, x);
+  }
+  if(a < 1){
+    *ip = __builtin_copysignl(0.0L, x);
+    return x;
+  }
+
+  long double t = (a + big) - big;
+  if(t > a) t -= 1;
+  *ip = __builtin_copysignl(t, x);
+  return __builtin_copysignl(a - t, x);
+}
+
+#endif
+
+#endif
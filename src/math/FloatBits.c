@@ -0,0 +1,73 @@
+/*
+
+  FloatBits.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FLOATBITS_C
+#define MATH_FLOATBITS_C
+
+#include <stdint.h>
+
+
+/*
+
+  Reinterprets the bits of a double as a 64 bit unsigned integer and back.
+
+  Going through a union is the one way of type punning that C guarantees, and
+  compilers turn it into a single register move.
+
+*/
+static inline uint64_t doubleToBits(double x){
+  union { double f; uint64_t i; } u = { x };
+  return u.i;
+}
+
+static inline double bitsToDouble(uint64_t i){
+  union { uint64_t i; double f; } u = { i };
+  return u.f;
+}
+
+
+/*
+
+  Same as above, for float and 32 bit unsigned integers
+
+*/
+static inline uint32_t floatToBits(float x){
+  union { float f; uint32_t i; } u = { x };
+  return u.i;
+}
+
+static inline float bitsToFloat(uint32_t i){
+  union { uint32_t i; float f; } u = { i };
+  return u.f;
+}
+
+
+/*
+
+  Returns a if cond is nonzero, otherwise b.
+
+  The same as cond ? a : b, but done with bit masks. When a or b is computed
+  only to be picked here, compilers move that computation behind a branch, and
+  then can't vectorize the loop (because the computation might raise a
+  floating-point exception the branch would have avoided). Masks have no
+  branch to move it behind.
+
+*/
+static inline double selectDouble(uint64_t cond, double a, double b){
+  uint64_t mask = -(uint64_t)(cond != 0);
+  return bitsToDouble((doubleToBits(a) & mask) | (doubleToBits(b) & ~mask));
+}
+
+static inline float selectFloat(uint32_t cond, float a, float b){
+  uint32_t mask = -(uint32_t)(cond != 0);
+  return bitsToFloat((floatToBits(a) & mask) | (floatToBits(b) & ~mask));
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+
+  FloatPoly.c
+
+  Generated by tools/remez.c, do not edit. To regenerate:
+
+    remez src/math/FloatPoly.c \
+      SIN_FLOAT_POLY=sin,4,-0.7854,0.7854,double \
+      COS_FLOAT_POLY=cos1,4,-0.7854,0.7854,double
+
+*/
+
+#ifndef MATH_FLOATPOLY_C
+#define MATH_FLOATPOLY_C
+
+#include "math/CacheLine.c"
+
+
+/*
+
+  sin(x) = x + x^3*P(x^2) on [-0.7854,0.7854],
+  relative error at most 2^-37.5
+
+*/
+static const double SIN_FLOAT_POLY[4] CACHE_ALIGNED = {
+  -0x1.5555554c71c65p-3,
+   0x1.1111086a59672p-7,
+  -0x1.a00f7f224ad03p-13,
+   0x1.6cd1f1228c51ep-19
+};
+
+#define SIN_FLOAT_POLY_ERROR 0x1.8p-38
+
+
+/*
+
+  cos(x) = 1 + x^2*P(x^2) on [-0.7854,0.7854],
+  relative error at most 2^-33.9
+
+*/
+static const double COS_FLOAT_POLY[4] CACHE_ALIGNED = {
+  -0x1.ffffffcb82a73p-2,
+   0x1.55553c788206p-5,
+  -0x1.6c07f160089d5p-10,
+   0x1.99169d9c76323p-16
+};
+
+#define COS_FLOAT_POLY_ERROR 0x1.4p-34
+
+#endif
@@ -0,0 +1,145 @@
+/*
+
+  FloatToInt.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FLOATTOINT_C
+#define MATH_FLOATTOINT_C
+
+#include "math.h"
+#include <float.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+
+#if defined(__SSE2__) && defined(__x86_64__)
+  #include <emmintrin.h>
+  #define FLOAT_TO_INT_CVT
+#endif
+
+
+/*
+
+  Arguments of lrint and lround have to be in [-INT64_RANGE,INT64_RANGE) to
+  fit in 64 bits at all. The conversions below assume they are.
+
+*/
+#define INT64_RANGE 0x1p63
+
+
+/*
+
+  Rounds x to an integer in the current rounding direction.
+
+  On x86-64 this is the cvtsd2si instruction (cvtss2si for float), which
+  rounds in the current direction as it converts. Elsewhere adding and
+  subtracting 2^52 rounds x first, and the conversion that follows is exact.
+
+*/
+static inline int64_t rintToInt64(double x){
+#ifdef FLOAT_TO_INT_CVT
+  return _mm_cvtsd_si64(_mm_set_sd(x));
+#else
+  double magic = __builtin_copysign(0x1p52, x);
+  double r = (x + magic) - magic;
+  return (int64_t)(__builtin_fabs(x) < 0x1p52 ? r : x);
+#endif
+}
+
+static inline int64_t rintfToInt64(float x){
+#ifdef FLOAT_TO_INT_CVT
+  return _mm_cvtss_si64(_mm_set_ss(x));
+#else
+  float magic = __builtin_copysignf(0x1p23f, x);
+  float r = (x + magic) - magic;
+  return (int64_t)(__builtin_fabsf(x) < 0x1p23f ? r : x);
+#endif
+}
+
+
+/*
+
+  Rounds x to the nearest integer, halfway cases away from zero, whatever the
+  rounding direction. The truncating conversion is one instruction everywhere,
+  and x minus its truncation is exact, so all that is left is to step away
+  from zero when that difference is at least a half.
+
+*/
+static inline int64_t roundToInt64(double x){
+  int64_t t = (int64_t)x;
+  double d = x - (double)t;
+  return t + (d >= 0.5) - (d <= -0.5);
+}
+
+static inline int64_t roundfToInt64(float x){
+  int64_t t = (int64_t)x;
+  float d = x - (float)t;
+  return t + (d >= 0.5f) - (d <= -0.5f);
+}
+
+
+/*
+
+  Out of range conversions raise the invalid exception, as the conversion
+  instructions do
+
+*/
+static inline void raiseInvalid(void){
+  volatile double zero = 0;
+  volatile double nan = zero/zero;
+  (void)nan;
+}
+
+
+/*
+
+  Branch-free, saturating conversion for the array functions.
+
+  x is clamped to [lo,hi] (NaN becomes 0), both whole numbers of magnitude
+  below 2^51, and rounded in the current direction by adding and subtracting
+  2^52 of its own sign. (A magic number of one sign would round negative x
+  the wrong way when rounding toward zero.) Adding 1.5*2^52 to the result is
+  then exact and leaves the integer in the low bits of the sum, so
+  subtracting the bits of 1.5*2^52 gives it without a conversion instruction.
+  All of it is plain arithmetic and masks, so loops over it vectorize. (The
+  comparisons are the quiet ones, so NaNs raise nothing.)
+
+*/
+static inline int64_t rintSaturate(double x, double lo, double hi){
+  x = selectDouble(x == x, x, 0);
+  x = selectDouble(__builtin_isgreater(x, lo), x, lo);
+  x = selectDouble(__builtin_isless(x, hi), x, hi);
+  double magic = __builtin_copysign(0x1p52, x);
+  double r = (x + magic) - magic;
+  return (int64_t)(doubleToBits(r + 0x1.8p52) - doubleToBits(0x1.8p52));
+}
+
+// The same in float, for lo and hi below 2^22
+static inline int32_t rintSaturatef(float x, float lo, float hi){
+  x = selectFloat(x == x, x, 0);
+  x = selectFloat(__builtin_isgreater(x, lo), x, lo);
+  x = selectFloat(__builtin_isless(x, hi), x, hi);
+  float magic = __builtin_copysignf(0x1p23f, x);
+  float r = (x + magic) - magic;
+  return (int32_t)(floatToBits(r + 0x1.8p23f) - floatToBits(0x1.8p23f));
+}
+
+
+/*
+
+  Saturating conversion of any x to int64_t, for the elements of an array too
+  large for rintSaturate
+
+*/
+static inline int64_t rintSaturate64(double x){
+  if(x != x) return 0;
+  if(x >= INT64_RANGE) return INT64_MAX;
+  if(x < -INT64_RANGE) return INT64_MIN;
+  return rintToInt64(x);
+}
+
+#endif
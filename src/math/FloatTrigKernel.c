@@ -0,0 +1,83 @@
+/*
+
+  FloatTrigKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FLOATTRIGKERNEL_C
+#define MATH_FLOATTRIGKERNEL_C
+
+#include "math.h"
+#include "math/FloatPoly.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+#include "math/TrigReduce.c"
+
+
+/*
+
+  Kernels for cosf, sinf and tanf.
+
+  Every float is exact as a double, so the argument is reduced and the
+  polynomial evaluated in double, and the result is rounded to float once at
+  the end. A result that is only going to be a float needs an error of about
+  2^-30 before that rounding, not the 2^-58 of the double kernels, so the
+  polynomials (from tools/remez.c, in FloatPoly.c) have four terms instead of
+  six, and the reduction's tail is dropped. Squares of floats are normal
+  doubles, so there is no tiny argument path to avoid subnormals either.
+
+*/
+
+
+/*
+
+  sin(x) = x + x^3*S(x^2) and cos(x) = 1 + x^2*C(x^2) on [-pi/4,pi/4]. For
+  x = -0 the x^3 term is +0, which would make the sum +0, so sin takes the
+  sign of x back at the end (it is the sign of the result on this range).
+
+*/
+static inline double sinFloatKernel(double x){
+  double z = x*x;
+  double y = MULADD(x*z, polynomial(z, SIN_FLOAT_POLY, 4), x);
+  return __builtin_copysign(y, x);
+}
+
+static inline double cosFloatKernel(double x){
+  double z = x*x;
+  return MULADD(z, polynomial(z, COS_FLOAT_POLY, 4), 1.0);
+}
+
+
+/*
+
+  Reduces finite x to y in [-pi/4,pi/4] and returns the quadrant, like
+  trigReduce, but without reducing at all when |x| <= pi/4
+
+*/
+static inline int trigReduceFloat(float x, double *y){
+  double y1;
+  *y = x;
+  if(__builtin_fabsf(x) <= PIO4) return 0;
+  return trigReduce(x, y, &y1);
+}
+
+
+/*
+
+  Returns sin(x), or cos(x) if cosine is nonzero, for finite x. cos is sin a
+  quadrant further on.
+
+*/
+static inline double trigFloat(float x, int cosine){
+  double y;
+  int n = trigReduceFloat(x, &y) + cosine;
+
+  double v = (n & 1) ? cosFloatKernel(y) : sinFloatKernel(y);
+  return (n & 2) ? -v : v;
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+
+  FlushSubnormals.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FLUSHSUBNORMALS_C
+#define MATH_FLUSHSUBNORMALS_C
+
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <xmmintrin.h>
+  #define FLUSH_SUBNORMALS_MXCSR
+#elif defined(__aarch64__)
+  #define FLUSH_SUBNORMALS_FPCR
+#endif
+
+
+/*
+
+  Whether the batch functions run with subnormals flushed to zero on this
+  thread, set through math_flush_subnormals
+
+*/
+extern _Thread_local int mathFlushSubnormals;
+
+
+/*
+
+  The batch functions bracket their loops with these:
+
+    uint64_t saved = flushSubnormalsBegin();
+    ...
+    flushSubnormalsEnd(saved);
+
+  When flushing is off they do nothing. When it is on, Begin saves the
+  floating-point control register and turns on flush-to-zero (subnormal
+  results become zero) and denormals-are-zero (subnormal inputs are read as
+  zero), and End puts the register back. On x86 the exception flags share the
+  register with the mode bits, so any raised in between are kept.
+
+  On targets with neither x86 SSE nor AArch64, flushing isn't supported and
+  these do nothing either way.
+
+*/
+#if defined(FLUSH_SUBNORMALS_MXCSR)
+
+// MXCSR bits: FTZ, DAZ, and the six exception flags
+#define MXCSR_FTZ 0x8000
+#define MXCSR_DAZ 0x0040
+#define MXCSR_FLAGS 0x003f
+
+static inline uint64_t flushSubnormalsBegin(void){
+  if(!mathFlushSubnormals) return 0;
+  unsigned csr = _mm_getcsr();
+  _mm_setcsr(csr | MXCSR_FTZ | MXCSR_DAZ);
+  return csr;
+}
+
+static inline void flushSubnormalsEnd(uint64_t saved){
+  if(!mathFlushSubnormals) return;
+  _mm_setcsr((unsigned)saved | (_mm_getcsr() & MXCSR_FLAGS));
+}
+
+#elif defined(FLUSH_SUBNORMALS_FPCR)
+
+// FPCR.FZ flushes both subnormal inputs and results. Flags live in FPSR.
+#define FPCR_FZ ((uint64_t)1 << 24)
+
+static inline uint64_t flushSubnormalsBegin(void){
+  if(!mathFlushSubnormals) return 0;
+  uint64_t fpcr;
+  __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+  __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | FPCR_FZ));
+  return fpcr;
+}
+
+static inline void flushSubnormalsEnd(uint64_t saved){
+  if(!mathFlushSubnormals) return;
+  __asm__ __volatile__("msr fpcr, %0" : : "r"(saved));
+}
+
+#else
+
+static inline uint64_t flushSubnormalsBegin(void){
+  return 0;
+}
+
+static inline void flushSubnormalsEnd(uint64_t saved){
+  (void)saved;
+}
+
+#endif
+
+#endif
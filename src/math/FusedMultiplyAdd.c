@@ -0,0 +1,273 @@
+/*
+
+  FusedMultiplyAdd.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FUSEDMULTIPLYADD_C
+#define MATH_FUSEDMULTIPLYADD_C
+
+#include "math.h"
+#include <float.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/Exponent.c"
+
+#if defined(__FMA__) && (defined(__x86_64__) || defined(__i386__))
+  #include <immintrin.h>
+#endif
+
+#ifndef FP_FAST_FMA
+
+/*
+
+  A double pulled apart into sign, integer significand and exponent so that
+  value = (-1)^sign * m * 2^e. The significand is shifted up one bit, so its
+  lowest bit is free to be used as a sticky bit when the value gets shifted
+  right during alignment.
+
+*/
+struct unpackedDouble {
+  uint64_t m;
+  int e;
+  int sign;
+};
+
+/*
+
+  Exponents of zero, infinity and NaN after unpacking are all at or above this
+  value, which lets fma pick those out with a single comparison
+
+*/
+#define FMA_ZEROINFNAN (0x7ff-0x3ff-52-1)
+
+
+static struct unpackedDouble unpackDouble(double x){
+  uint64_t bits = doubleToBits(x);
+  int e = bits>>52;
+  int sign = e & 0x800;
+
+  e &= 0x7ff;
+  if(!e){
+    // Subnormal (or zero), scale it into the normal range first
+    bits = doubleToBits(x*0x1p63);
+    e = bits>>52 & 0x7ff;
+    e = e ? e-63 : 0x800;
+  }
+
+  bits &= (1ull<<52)-1;
+  bits |= 1ull<<52;
+  bits <<= 1;
+  e -= 0x3ff+52+1;
+
+  return (struct unpackedDouble){bits, e, sign};
+}
+
+
+/*
+
+  Full 64x64 -> 128 bit multiplication, done in 32 bit halves so that it works
+  without a 128 bit integer type
+
+*/
+static void multiply64(uint64_t *hi, uint64_t *lo, uint64_t x, uint64_t y){
+  uint64_t xlo = (uint32_t)x, xhi = x>>32;
+  uint64_t ylo = (uint32_t)y, yhi = y>>32;
+
+  uint64_t t1 = xlo*ylo;
+  uint64_t t2 = xlo*yhi + xhi*ylo;
+  uint64_t t3 = xhi*yhi;
+
+  *lo = t1 + (t2<<32);
+  *hi = t3 + (t2>>32) + (t1 > *lo);
+}
+
+
+/*
+
+  Software fused multiply-add for targets without the instruction.
+
+  The product of two 53 bit significands is exactly 106 bits, so it is formed
+  in two 64 bit words. z is lined up against it (anything shifted out is kept
+  as a sticky bit), the two are added, and the top 63 bits are converted to
+  double in one go. That conversion is the one and only rounding.
+
+*/
+static double softwareFma(double x, double y, double z){
+  struct unpackedDouble nx = unpackDouble(x);
+  struct unpackedDouble ny = unpackDouble(y);
+  struct unpackedDouble nz = unpackDouble(z);
+
+  // Zero, infinite or NaN operands are already handled right by the hardware
+  if(nx.e >= FMA_ZEROINFNAN || ny.e >= FMA_ZEROINFNAN) return x*y + z;
+  if(nz.e >= FMA_ZEROINFNAN){
+    if(nz.e > FMA_ZEROINFNAN) return x*y + z; // z is zero
+    return z;
+  }
+
+  // r = x*y
+  uint64_t rhi, rlo, zhi, zlo;
+  multiply64(&rhi, &rlo, nx.m, ny.m);
+
+  /*
+    Line up the exponents. z is shifted left as far as it goes, then the
+    product is shifted right, collecting lost bits into the sticky bit.
+  */
+  int e = nx.e + ny.e;
+  int d = nz.e - e;
+  if(d > 0){
+    if(d < 64){
+      zlo = nz.m<<d;
+      zhi = nz.m>>(64-d);
+    }else{
+      zlo = 0;
+      zhi = nz.m;
+      e = nz.e - 64;
+      d -= 64;
+      if(d == 0){
+      }else if(d < 64){
+        rlo = rhi<<(64-d) | rlo>>d | !!(rlo<<(64-d));
+        rhi = rhi>>d;
+      }else{
+        rlo = 1;
+        rhi = 0;
+      }
+    }
+  }else{
+    zhi = 0;
+    d = -d;
+    if(d == 0){
+      zlo = nz.m;
+    }else if(d < 64){
+      zlo = nz.m>>d | !!(nz.m<<(64-d));
+    }else{
+      zlo = 1;
+    }
+  }
+
+  // r += z, or r -= z when the signs differ
+  int sign = nx.sign ^ ny.sign;
+  int nonzero = 1;
+  if(sign == nz.sign){
+    rlo += zlo;
+    rhi += zhi + (rlo < zlo);
+  }else{
+    uint64_t t = rlo;
+    rlo -= zlo;
+    rhi = rhi - zhi - (t < rlo);
+    if(rhi>>63){
+      rlo = -rlo;
+      rhi = -rhi - !!rlo;
+      sign = !sign;
+    }
+    nonzero = !!rhi;
+  }
+
+  // Move the top 63 bits of the sum into rhi, the last bit being sticky
+  if(nonzero){
+    e += 64;
+    d = __builtin_clzll(rhi)-1;
+    rhi = rhi<<d | rlo>>(64-d) | !!(rlo<<d);
+  }else if(rlo){
+    d = __builtin_clzll(rlo)-1;
+    if(d < 0) rhi = rlo>>1 | (rlo&1);
+    else rhi = rlo<<d;
+  }else{
+    // Exact zero, let the hardware pick its sign
+    return x*y + z;
+  }
+  e -= d;
+
+  // This conversion is the rounding step, |r| ends up in [2^62,2^63]
+  int64_t i = rhi;
+  if(sign) i = -i;
+  double r = i;
+
+  if(e < -1022-62){
+    /*
+      The result is subnormal, so scaling it down afterwards would round a
+      second time. Round to the right number of bits here instead.
+    */
+    if(e == -1022-63){
+      double c = sign ? -0x1p63 : 0x1p63;
+      if(r == c){
+        /*
+          Rounded up to the smallest normal number. Whether underflow is raised
+          depends on the hardware, which a float conversion imitates.
+        */
+        float fltmin = 0x0.ffffff8p-63f*FLT_MIN*r;
+        return DBL_MIN/FLT_MIN*fltmin;
+      }
+      // One bit is lost when scaled, add a top bit so it only rounds once
+      if(rhi << 53){
+        i = rhi>>1 | (rhi&1) | 1ull<<62;
+        if(sign) i = -i;
+        r = i;
+        r = 2*r - c;
+        // Raise underflow in a way the compiler can not optimize away
+        volatile double tiny = DBL_MIN/FLT_MIN * r;
+        r += (double)(tiny*tiny) * (r-r);
+      }
+    }else{
+      d = 10;
+      i = (rhi>>d | !!(rhi<<(64-d))) << d;
+      if(sign) i = -i;
+      r = i;
+    }
+  }
+  return scalbnCore(r, e);
+}
+
+#endif
+
+
+/*
+
+  (x*y)+z rounded once, for fma and for the kernels that need it exact rather
+  than as the MULADD of MulAdd.c (which may round twice).
+
+  With the instruction, __builtin_fma would do, but inside fma itself GCC
+  takes it for a call to fma and warns of infinite recursion. So on x86 and
+  ARM the instruction is reached directly, through its intrinsic or inline
+  assembly, and the builtin is left for other targets that have one.
+
+*/
+static inline double fusedMultiplyAdd(double x, double y, double z){
+#if defined(__FMA__) && (defined(__x86_64__) || defined(__i386__))
+  __m128d r = _mm_fmadd_sd(_mm_set_sd(x), _mm_set_sd(y), _mm_set_sd(z));
+  return _mm_cvtsd_f64(r);
+#elif defined(__aarch64__)
+  double r;
+  __asm__("fmadd %d0, %d1, %d2, %d3" : "=w"(r) : "w"(x), "w"(y), "w"(z));
+  return r;
+#elif defined(FP_FAST_FMA)
+  return __builtin_fma(x, y, z);
+#else
+  return softwareFma(x, y, z);
+#endif
+}
+
+#ifdef FP_FAST_FMAF
+
+// float counterpart, only where the instruction exists (fmaf has its own
+// software version)
+static inline float fusedMultiplyAddf(float x, float y, float z){
+#if defined(__FMA__) && (defined(__x86_64__) || defined(__i386__))
+  __m128 r = _mm_fmadd_ss(_mm_set_ss(x), _mm_set_ss(y), _mm_set_ss(z));
+  return _mm_cvtss_f32(r);
+#elif defined(__aarch64__)
+  float r;
+  __asm__("fmadd %s0, %s1, %s2, %s3" : "=w"(r) : "w"(x), "w"(y), "w"(z));
+  return r;
+#else
+  return __builtin_fmaf(x, y, z);
+#endif
+}
+
+#endif
+
+#endif
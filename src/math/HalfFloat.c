@@ -0,0 +1,142 @@
+/*
+
+  HalfFloat.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HALFFLOAT_C
+#define MATH_HALFFLOAT_C
+
+#include <stddef.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+
+#if defined(__F16C__) && defined(__AVX__)
+  #include <immintrin.h>
+#endif
+
+
+/*
+
+  Conversions between float and the two 16 bit formats, passed around as their
+  bit patterns:
+
+    half (IEEE binary16, _Float16): 1 sign, 5 exponent and 10 fraction bits
+    bfloat16:                      1 sign, 8 exponent and 7 fraction bits
+
+  bfloat16 is just the top half of a float, so it converts by shifting.
+  Half has its own exponent range and needs rebiasing, with subnormals and
+  infinities/NaNs handled separately. Both directions are written without
+  branches so that array conversions vectorize. Narrowing rounds to nearest
+  even, like a cast would.
+
+*/
+static inline float halfToFloat(uint16_t h){
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  uint32_t em = h & 0x7fff;
+
+  // Move exponent and fraction into place and rebias the exponent
+  uint32_t normal = (em << 13) + ((127-15) << 23);
+
+  // Infinities and NaNs get the rest of the float exponent range
+  normal = em >= 0x7c00 ? normal + ((128-16) << 23) : normal;
+
+  // Subnormals are read as 2^-14 * (1.fraction), and 2^-14 taken off again
+  float subnormal = bitsToFloat(normal + (1u << 23)) - 0x1p-14f;
+
+  float f = selectFloat(em < 0x0400, subnormal, bitsToFloat(normal));
+  return bitsToFloat(floatToBits(f) | sign);
+}
+
+static inline uint16_t floatToHalf(float f){
+  uint32_t x = floatToBits(f);
+  uint32_t sign = (x >> 16) & 0x8000;
+  uint32_t a = x & 0x7fffffff;
+
+  // Rebias, then round the 13 bits that go away to nearest even. A carry out
+  // of the fraction correctly bumps the exponent, up to infinity.
+  uint32_t normal = (a - ((127-15) << 23) + 0xfff + ((a >> 13) & 1)) >> 13;
+
+  // Below 2^-14 the result is subnormal: the significand, with its implicit
+  // bit, shifted down to units of 2^-24 and rounded the same way
+  uint32_t shift = 126 - (a >> 23);
+  shift = shift > 31 ? 31 : shift;
+  uint32_t m = (a & 0x7fffff) | 0x800000;
+  uint32_t subnormal = (m + (1u << (shift-1)) - 1 + ((m >> shift) & 1))
+                       >> shift;
+
+  uint32_t h = a < (113u << 23) ? subnormal : normal;
+
+  // Anything past the largest half, infinity included, has rounded to at
+  // least the bits of infinity, and NaNs become a quiet NaN
+  h = h > 0x7c00 ? 0x7c00 : h;
+  h |= (uint32_t)(a > 0x7f800000u) << 9;
+  return (uint16_t)(h | sign);
+}
+
+static inline float bf16ToFloat(uint16_t b){
+  return bitsToFloat((uint32_t)b << 16);
+}
+
+static inline uint16_t floatToBf16(float f){
+  uint32_t x = floatToBits(f);
+  uint32_t rounded = (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+
+  // Rounding could carry a NaN into infinity, so NaNs are kept and quieted
+  uint32_t nan = (x >> 16) | 0x0040;
+  return (uint16_t)((x & 0x7fffffff) > 0x7f800000u ? nan : rounded);
+}
+
+
+/*
+
+  Convert n values between a 16 bit array and a float array.
+
+  With F16C the half conversions are single instructions, 8 values at a time.
+  Otherwise, and for the ends of arrays, the functions above are used.
+
+*/
+static inline void halfToFloatArray(const uint16_t *x, float *y, size_t n){
+  size_t i = 0;
+#if defined(__F16C__) && defined(__AVX__)
+  for(; i+8 <= n; i += 8){
+    __m128i h = _mm_loadu_si128((const __m128i *)(x+i));
+    _mm256_storeu_ps(y+i, _mm256_cvtph_ps(h));
+  }
+#endif
+  for(; i < n; i++){
+    y[i] = halfToFloat(x[i]);
+  }
+}
+
+static inline void floatToHalfArray(const float *x, uint16_t *y, size_t n){
+  size_t i = 0;
+#if defined(__F16C__) && defined(__AVX__)
+  for(; i+8 <= n; i += 8){
+    __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(x+i),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128((__m128i *)(y+i), h);
+  }
+#endif
+  for(; i < n; i++){
+    y[i] = floatToHalf(x[i]);
+  }
+}
+
+static inline void bf16ToFloatArray(const uint16_t *x, float *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = bf16ToFloat(x[i]);
+  }
+}
+
+static inline void floatToBf16Array(const float *x, uint16_t *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = floatToBf16(x[i]);
+  }
+}
+
+#endif
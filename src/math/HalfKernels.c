@@ -0,0 +1,143 @@
+/*
+
+  HalfKernels.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HALFKERNELS_C
+#define MATH_HALFKERNELS_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/HalfPoly.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+#include "math/TrigReduce.c"
+
+
+/*
+
+  Float kernels for results that will be rounded to half or bfloat16.
+
+  Those formats keep 11 and 8 significant bits, so these only aim for an error
+  of about 2^-20 relative, which is a fraction of a unit in the last place of
+  either and leaves room for the final rounding. That takes polynomials of
+  about half the degree the double kernels need, evaluated in float. The
+  minimax tables for them are generated by tools/remez.c into HalfPoly.c,
+  along with their errors.
+
+  There are no branches, so the array loops calling these vectorize, with
+  twice as many lanes as double.
+
+*/
+
+
+/*
+
+  sin(x) = x + x^3*S(x^2) and cos(x) = 1 + x^2*C(x^2) on [-pi/4,pi/4]. sin
+  takes the sign of x back at the end, since for x = -0 the x^3 term is +0 and
+  -0 + +0 is +0.
+
+*/
+static inline float sinHalfKernel(float x){
+  float z = x*x;
+  float y = MULADDF(x*z, polynomialf(z, SIN_HALF_POLY, 3), x);
+  return __builtin_copysignf(y, x);
+}
+
+static inline float cosHalfKernel(float x){
+  float z = x*x;
+  return MULADDF(z, polynomialf(z, COS_HALF_POLY, 3), 1.0f);
+}
+
+
+/*
+
+  Returns sin(x), or cos(x) if cosine is nonzero, for |x| < TRIG_REDUCE_MEDIUM.
+
+  The argument is reduced in double with the usual Cody-Waite reduction, since
+  float doesn't have the bits to cancel against pi/2 for large arguments. Only
+  the head of the reduced argument matters at this precision. cos is sin a
+  quadrant further on.
+
+*/
+static inline float trigHalfMedium(float x, int cosine){
+  double y0, y1;
+  uint32_t n = (uint32_t)(trigReduceMedium(x, &y0, &y1) + cosine);
+
+  float r = (float)y0;
+  float v = selectFloat(n & 1, cosHalfKernel(r), sinHalfKernel(r));
+  return bitsToFloat(floatToBits(v) ^ ((n & 2) << 30));
+}
+
+// The same for any finite x, going through the full reduction
+static inline float trigHalfLarge(float x, int cosine){
+  double y0, y1;
+  uint32_t n = (uint32_t)(trigReduce(x, &y0, &y1) + cosine);
+
+  float r = (float)y0;
+  float v = (n & 1) ? cosHalfKernel(r) : sinHalfKernel(r);
+  return (n & 2) ? -v : v;
+}
+
+
+/*
+
+  exp(x) = 2^k * exp(r), where k is x/log(2) rounded and r = x - k*log(2) is in
+  [-log(2)/2,log(2)/2]. log(2) is split in two so that k*LN2_HI is exact.
+
+  x is clamped to where the result goes from zero to infinity in float. 2^k is
+  applied as two halves so that k can reach below the smallest normal and past
+  the largest exponent without a special case. NaN passes through the
+  clamps and the arithmetic as NaN.
+
+*/
+static const float LN2_HI_HALF = 0x1.62ep-1f;
+static const float LN2_LO_HALF = 0x1.0bfbe8p-15f;
+
+static inline float expHalfKernel(float x){
+  x = x < -104.0f ? -104.0f : x;
+  x = x > 89.0f ? 89.0f : x;
+
+  // k appears in the low bits of the sum, as in halfTurnReduce
+  float kf = MULADDF(x, 0x1.715476p0f, 0x1.8p23f);
+  int32_t k = (int32_t)(floatToBits(kf) - floatToBits(0x1.8p23f));
+  kf -= 0x1.8p23f;
+
+  float r = MULADDF(-kf, LN2_HI_HALF, x);
+  r = MULADDF(-kf, LN2_LO_HALF, r);
+
+  float p = polynomialf(r, EXP_HALF_POLY, 6);
+
+  int32_t k1 = k >> 1;
+  float s1 = bitsToFloat((uint32_t)(k1 + 127) << 23);
+  float s2 = bitsToFloat((uint32_t)(k - k1 + 127) << 23);
+  return p*s1*s2;
+}
+
+
+/*
+
+  tanh(x) = sign(x) * (1 - 2/(exp(2|x|)+1)), except near zero, where that
+  formula cancels down to nothing and x + x^3*T(x^2) is used instead. Large |x|
+  makes exp infinite and the result exactly 1.
+
+*/
+static inline float tanhHalfKernel(float x){
+  float a = __builtin_fabsf(x);
+  float z = x*x;
+  float small = MULADDF(x*z, polynomialf(z, TANH_HALF_POLY, 3), x);
+  small = __builtin_copysignf(small, x); // as in sinHalfKernel
+
+  float e = expHalfKernel(2*a);
+  float large = __builtin_copysignf(1.0f - 2.0f/(e + 1.0f), x);
+
+  return selectFloat(a < 0.4f, small, large);
+}
+
+#endif
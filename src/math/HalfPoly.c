@@ -0,0 +1,83 @@
+/*
+
+  HalfPoly.c
+
+  Generated by tools/remez.c, do not edit. To regenerate:
+
+    remez src/math/HalfPoly.c \
+      SIN_HALF_POLY=sin,3,-0.7854,0.7854,float \
+      COS_HALF_POLY=cos1,3,-0.7854,0.7854,float \
+      EXP_HALF_POLY=exp,6,-0.3466,0.3466,float \
+      TANH_HALF_POLY=tanh,3,-0.4,0.4,float
+
+*/
+
+#ifndef MATH_HALFPOLY_C
+#define MATH_HALFPOLY_C
+
+#include "math/CacheLine.c"
+
+
+/*
+
+  sin(x) = x + x^3*P(x^2) on [-0.7854,0.7854],
+  relative error at most 2^-27.9
+
+*/
+static const float SIN_HALF_POLY[3] CACHE_ALIGNED = {
+  -0x1.555546p-3f,
+   0x1.110778p-7f,
+  -0x1.995406p-13f
+};
+
+#define SIN_HALF_POLY_ERROR 0x1.4p-28
+
+
+/*
+
+  cos(x) = 1 + x^2*P(x^2) on [-0.7854,0.7854],
+  relative error at most 2^-24.6
+
+*/
+static const float COS_HALF_POLY[3] CACHE_ALIGNED = {
+  -0x1.ffffb2p-2f,
+   0x1.553e5ep-5f,
+  -0x1.6447c6p-10f
+};
+
+#define COS_HALF_POLY_ERROR 0x1.8p-25
+
+
+/*
+
+  exp(x) = P(x) on [-0.3466,0.3466],
+  relative error at most 2^-23.0
+
+*/
+static const float EXP_HALF_POLY[6] CACHE_ALIGNED = {
+   0x1.000002p+0f,
+   0x1.fffffep-1f,
+   0x1.fffbf2p-2f,
+   0x1.55530cp-3f,
+   0x1.57b9e8p-5f,
+   0x1.13ce7p-7f
+};
+
+#define EXP_HALF_POLY_ERROR 0x1.4p-23
+
+
+/*
+
+  tanh(x) = x + x^3*P(x^2) on [-0.4,0.4],
+  relative error at most 2^-23.0
+
+*/
+static const float TANH_HALF_POLY[3] CACHE_ALIGNED = {
+  -0x1.555188p-2f,
+   0x1.0fed14p-3f,
+  -0x1.8788c2p-5f
+};
+
+#define TANH_HALF_POLY_ERROR 0x1p-23
+
+#endif
@@ -0,0 +1,95 @@
+/*
+
+  HalfTurnKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HALFTURNKERNEL_C
+#define MATH_HALFTURNKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/HalfTurnReduce.c"
+#include "math/SinKernel.c"
+#include "math/CosKernel.c"
+
+
+/*
+
+  Branch-free body of sinpi, shared with sinpi_batch
+
+*/
+static inline double sinpiCore(double t){
+  double r, hi, lo;
+  uint64_t n = halfTurnReduce(t, &r);
+  timesPi(r, &hi, &lo);
+
+  double s = sinKernel(hi, lo);
+  double c = cosKernel(hi, lo);
+  double y = selectDouble(n & 1, c, s);
+  y = selectDouble(n & 2, -y, y);
+
+  // Whole numbers of half turns are exact zeros with the sign of t
+  return selectDouble((r == 0) & ~n & 1, __builtin_copysign(0.0, t), y);
+}
+
+
+/*
+
+  Branch-free body of cospi, shared with cospi_batch
+
+*/
+static inline double cospiCore(double t){
+  double r, hi, lo;
+  uint64_t n = halfTurnReduce(t, &r);
+  timesPi(r, &hi, &lo);
+
+  double s = sinKernel(hi, lo);
+  double c = cosKernel(hi, lo);
+  double y = selectDouble(n & 1, s, c);
+  y = selectDouble((n+1) & 2, -y, y);
+
+  // Half turns plus a quarter are exactly +0
+  return selectDouble((r == 0) & n & 1, 0.0, y);
+}
+
+
+/*
+
+  Branch-free body of tanpi, shared with tanpi_batch
+
+*/
+static inline double tanpiCore(double t){
+  double r, hi, lo;
+  uint64_t n = halfTurnReduce(t, &r);
+  timesPi(r, &hi, &lo);
+
+  double s = sinKernel(hi, lo);
+  double c = cosKernel(hi, lo);
+  double y = selectDouble(n & 1, -c, s) / selectDouble(n & 1, s, c);
+
+  /*
+    Exact zeros and poles. tan(n*pi) is +0 for positive even and negative odd
+    n, and -0 otherwise. tan((n+1/2)*pi) is +infinity for even n and -infinity
+    for odd n.
+  */
+  int negative = (doubleToBits(t) >> 63) ^ ((n >> 1) & 1);
+  double zero = selectDouble(negative, -0.0, 0.0);
+  double pole = selectDouble(((n-1) >> 1) & 1, -1/0.0, 1/0.0);
+  y = selectDouble(r == 0, selectDouble(n & 1, pole, zero), y);
+
+  /*
+    And exact ones, which the quotient misses by an ulp. tan(+-pi/4) is +-1,
+    with the sign flipped a quadrant on.
+  */
+  uint64_t minus = (doubleToBits(r) >> 63) ^ (n & 1);
+  double one = selectDouble(minus, -1.0, 1.0);
+  return selectDouble(__builtin_fabs(r) == 0.25, one, y);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+
+  HalfTurnReduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HALFTURNREDUCE_C
+#define MATH_HALFTURNREDUCE_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/DoubleDouble.c"
+
+
+/*
+
+  pi as a double plus the error of that double
+
+*/
+static const double PI_HI = 3.14159265358979311600e+00;
+static const double PI_LO = 1.22464679914735317720e-16;
+
+
+/*
+
+  Below HALF_TURN_TINY, sinpi(t) and tanpi(t) round to pi*t and cospi(t)
+  rounds to 1. The scalar functions return those straight away, without
+  running kernels on subnormal or nearly subnormal numbers.
+
+*/
+#define HALF_TURN_TINY 0x1p-30
+
+
+/*
+
+  Rounds x to the nearest integer (ties to even, in the default rounding mode)
+  by adding and subtracting 2^52, which pushes the fraction bits out the
+  bottom. Numbers of magnitude 2^52 and up are already integers and are
+  passed through.
+
+*/
+static inline double roundHalfTurns(double x){
+  double magic = __builtin_copysign(0x1p52, x);
+  double rounded = (x + magic) - magic;
+  int whole = (doubleToBits(x) << 1) >= (doubleToBits(0x1p52) << 1);
+  return selectDouble(whole, x, rounded);
+}
+
+
+/*
+
+  Reduces t, an angle measured in half turns (so pi radians is 1), to r in
+  [-1/4,1/4] such that t = n/2 + r, and returns n mod 4, the quadrant t is in.
+
+  Unlike reducing radians, where pi/2 can only ever be approximated, this is
+  exact. Whole turns are taken off first (t - 2*round(t/2) has no rounding
+  error), which leaves t in [-1,1]. Then n is 2t rounded, and t-n/2 is exact
+  again since the two are so close. No tables, no long products, no branches.
+
+  Huge arguments are all even integers and end up at exactly 0, infinities
+  become NaN, and NaN stays NaN.
+
+*/
+static inline uint64_t halfTurnReduce(double t, double *r){
+  t = t - 2*roundHalfTurns(0.5*t);
+
+  double fn = roundHalfTurns(2*t);
+  *r = t - 0.5*fn;
+
+  // n is a small integer, so it shows up in the low bits of fn + 1.5*2^52.
+  // Reading it from there keeps everything in 64 bit lanes.
+  return doubleToBits(fn + 0x1.8p52) & 3;
+}
+
+
+/*
+
+  Multiplies r by pi, giving the result as hi+lo so that the rounding of the
+  product isn't lost. The rounding error of r*PI_HI is taken exactly, with
+  mulError, since a plain MULADD only gives it with FMA and is 0 without.
+
+*/
+static inline void timesPi(double r, double *hi, double *lo){
+  *hi = r*PI_HI;
+  *lo = mulError(r, PI_HI, *hi) + r*PI_LO;
+}
+
+
+/*
+
+  pi*t for |t| < HALF_TURN_TINY, which is what sinpi and tanpi round to there.
+
+  |t| is scaled up by 2^110 first so that none of the products in timesPi
+  (down to r*PI_LO and the low halves in mulError) underflow. That is done on
+  the bits, since multiplying a subnormal costs a microcode assist on x86:
+  normal numbers get 110 added to the exponent, and subnormals have their
+  fraction bits turned into a double with the 2^52 trick and scaled from
+  there. The sign of t is put back at the end, which also keeps -0 (the error
+  term of 0 is +0).
+
+*/
+static inline double tinyTimesPi(double t){
+  uint64_t bits = doubleToBits(t) & 0x7fffffffffffffff;
+  double normal = bitsToDouble(bits + ((uint64_t)110 << 52));
+  double fraction = bitsToDouble(bits | doubleToBits(0x1p52)) - 0x1p52;
+  double scaled = selectDouble(bits >> 52 == 0, fraction*0x1p-964, normal);
+
+  double hi, lo;
+  timesPi(scaled, &hi, &lo);
+  return __builtin_copysign((hi + lo)*0x1p-110, t);
+}
+
+#endif
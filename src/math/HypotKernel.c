@@ -0,0 +1,91 @@
+/*
+
+  HypotKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HYPOTKERNEL_C
+#define MATH_HYPOTKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/DoubleDouble.c"
+#include "math/Sqrt.c"
+
+
+/*
+
+  Scales |x| and |y| by the same power of 2, 2^-E, stores the larger as a and
+  the smaller as b, and returns E with 2^E in up.
+
+  E is the exponent of the larger, so that it lands in [1,2) and neither
+  square can overflow, or underflow unless it is too small next to the other
+  to matter. E is kept within [-1000,1000], far enough in that 2^E and 2^-E are
+  both normal and the scaling is exact, which still leaves any finite x and y
+  scaled to where their squares are safe.
+
+*/
+static inline double hypotScale(double x, double y, double *a, double *b,
+                                double *up){
+  double ax = __builtin_fabs(x), ay = __builtin_fabs(y);
+  int swap = __builtin_isgreater(ay, ax);
+  double m = selectDouble(swap, ay, ax);
+
+  m = selectDouble(__builtin_isgreater(m, 0x1p1000), 0x1p1000, m);
+  m = selectDouble(__builtin_isless(m, 0x1p-1000), 0x1p-1000, m);
+  uint64_t e = doubleToBits(m) >> 52;
+
+  double down = bitsToDouble((2046 - e) << 52);
+  *a = selectDouble(swap, ay, ax)*down;
+  *b = selectDouble(swap, ax, ay)*down;
+  *up = bitsToDouble(e << 52);
+  return bitsToDouble(e | 0x4330000000000000u) - (0x1p52 + 1023);
+}
+
+
+/*
+
+  Returns a^2 + b^2 rounded, for a >= b >= 0, and stores in lo what was lost
+  to rounding, each square's error and the sum's, so the two add up to the
+  exact sum (less whatever b's square lost to underflow)
+
+*/
+static inline double sumSquares(double a, double b, double *lo){
+  double a2 = a*a, b2 = b*b;
+  double s = a2 + b2;
+  *lo = addError(a2, b2, s) + (mulError(a, a, a2) + mulError(b, b, b2));
+  return s;
+}
+
+
+/*
+
+  Returns sqrt(x^2 + y^2) for finite x and y (zeros included), without undue
+  overflow or underflow.
+
+  After scaling, the sum of squares is formed exactly as s + lo, its square
+  root h is taken, and corrected by one Newton step, h + (s + lo - h^2)/(2h),
+  with the residual computed exactly. That makes the result all but correctly
+  rounded, where the square root of the rounded sum alone can be off by a unit.
+
+*/
+static inline double hypotKernel(double x, double y){
+  double a, b, up, lo;
+  hypotScale(x, y, &a, &b, &up);
+  double s = sumSquares(a, b, &lo);
+
+  double h = squareRoot(s);
+  double h2 = h*h;
+  double residual = ((s - h2) - mulError(h, h, h2)) + lo;
+  double half = 0.5/selectDouble(__builtin_isgreater(h, 0), h, 1);
+
+  return MULADD(residual, half, h)*up;
+}
+
+#endif
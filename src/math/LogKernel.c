@@ -0,0 +1,69 @@
+/*
+
+  LogKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LOGKERNEL_C
+#define MATH_LOGKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+#include "math/ElementaryPoly.c"
+
+
+// log(2) split in two so that k*LOG_LN2_HI is exact for |k| < 2^21 (fdlibm)
+#define LOG_LN2_HI 6.93147180369123816490e-01
+#define LOG_LN2_LO 1.90821492927058770002e-10
+
+// Bit pattern of sqrt(2)/2, where the significand's range is made to start
+#define LOG_SQRT_HALF 0x3fe6a09e667f3bcdu
+
+
+/*
+
+  Splits a positive normal x into 2^k*(1+f), with 1+f in [sqrt(2)/2,sqrt(2)),
+  returning k as a double and storing f.
+
+  Adding the distance from sqrt(2)/2 to 1 to the bit pattern carries into the
+  exponent field exactly when the significand is past sqrt(2), so the exponent
+  is then k and the significand, moved back, 1+f. f is exact. k is turned into
+  a double by placing it in the significand of 2^52, which vectorizes where an
+  integer conversion wouldn't.
+
+*/
+static inline double logReduce(double x, double *f){
+  uint64_t u = doubleToBits(x) + (0x3ff0000000000000u - LOG_SQRT_HALF);
+  *f = bitsToDouble((u & 0x000fffffffffffffu) + LOG_SQRT_HALF) - 1;
+  return bitsToDouble((u >> 52) | 0x4330000000000000u) - (0x1p52 + 1023);
+}
+
+
+/*
+
+  Returns log(2^k*(1+f)) + tail, for the k and f of logReduce and a tail small
+  next to 1+f. The tail is the low part of an argument known to more than
+  double precision: log(2^k*(1+f+t)) is the above with tail = t/(1+f).
+
+  log(1+f) = 2s + s^3*P(s^2) where s = f/(2+f), which is rearranged as
+  f - f^2/2 + s*(f^2/2 + R) (with R = s^2*P(s^2)) so that f, which is exact,
+  is added last and everything rounded is small next to it (fdlibm).
+
+*/
+static inline double logKernel(double k, double f, double tail){
+  double s = f/(2 + f);
+  double z = s*s;
+  double r = z*polynomial(z, LOG_POLY, 7);
+  double hfsq = 0.5*f*f;
+
+  return k*LOG_LN2_HI - ((hfsq - (s*(hfsq + r) + (k*LOG_LN2_LO + tail))) - f);
+}
+
+#endif
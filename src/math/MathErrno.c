@@ -0,0 +1,35 @@
+/*
+
+  MathErrno.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_MATHERRNO_C
+#define MATH_MATHERRNO_C
+
+#include "math.h"
+
+
+/*
+
+  SET_ERRNO(e) stores e in errno when math_errhandling includes MATH_ERRNO.
+  Built with MATH_NO_ERRNO it disappears, argument and all, so functions are
+  left with no side effects other than floating-point exceptions, as their
+  const declarations promise.
+
+  Domain errors (an argument outside the function's domain) set EDOM, pole and
+  range errors set ERANGE.
+
+*/
+#ifdef MATH_NO_ERRNO
+  #define SET_ERRNO(e) ((void)0)
+#else
+  #include <errno.h>
+  #define SET_ERRNO(e) (errno = (e))
+#endif
+
+#endif
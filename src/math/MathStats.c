@@ -0,0 +1,102 @@
+/*
+
+  MathStats.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_MATHSTATS_C
+#define MATH_MATHSTATS_C
+
+#include "mathstats.h"
+
+
+/*
+
+  MATH_STATS_CALL(f, x) counts a call of function f with argument x, and
+  MATH_STATS_PATH(f, p) counts function f taking path p. Both disappear unless
+  the library is built with MATH_STATS defined.
+
+  Each thread counts into its own block, so the counters are never shared
+  between cores and an increment is just a load, add and store. The relaxed
+  atomics are only there so that math_stats_snapshot can read them from another
+  thread, on common hardware they compile to the same instructions as a plain
+  increment.
+
+*/
+#ifdef MATH_STATS
+
+#include <stdint.h>
+#include "math/FloatBits.c"
+
+
+/*
+
+  One thread's counters, kept on a list so snapshots can find them
+
+*/
+struct mathStatsThread {
+  struct math_stats stats;
+  struct mathStatsThread *next;
+};
+
+extern _Thread_local struct mathStatsThread *mathStatsLocal;
+struct mathStatsThread *mathStatsRegister(void);
+
+
+static inline struct math_stats_counters *mathStatsCounters(int f){
+  struct mathStatsThread *t = mathStatsLocal;
+  if(__builtin_expect(!t, 0)) t = mathStatsRegister();
+  return &t->stats.function[f];
+}
+
+static inline void mathStatsBump(uint64_t *counter, uint64_t n){
+  __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + n,
+                   __ATOMIC_RELAXED);
+}
+
+
+/*
+
+  Returns which magnitude bucket x belongs in, straight from its exponent bits
+
+*/
+static inline int mathStatsBucket(double x){
+  uint64_t bits = doubleToBits(x);
+  int e = (bits >> 52) & 0x7ff;
+
+  if(e == 0x7ff) return MATH_STATS_BUCKET_NONFINITE;
+  if(e == 0) return (bits << 1) ? MATH_STATS_BUCKET_SUBNORMAL : MATH_STATS_BUCKET_ZERO;
+
+  e -= 0x3ff;
+  if(e < MATH_STATS_MIN_EXP) return MATH_STATS_BUCKET_TINY;
+  if(e > MATH_STATS_MAX_EXP) return MATH_STATS_BUCKET_HUGE;
+  return MATH_STATS_BUCKET_EXP(e);
+}
+
+static inline void mathStatsCall(int f, double x){
+  struct math_stats_counters *c = mathStatsCounters(f);
+  mathStatsBump(&c->calls, 1);
+  mathStatsBump(&c->magnitude[mathStatsBucket(x)], 1);
+}
+
+static inline void mathStatsPath(int f, int p, uint64_t n){
+  mathStatsBump(&mathStatsCounters(f)->path[p], n);
+}
+
+  #define MATH_STATS_CALL(f, x) mathStatsCall((f), (x))
+  #define MATH_STATS_PATH(f, p) mathStatsPath((f), (p), 1)
+  #define MATH_STATS_PATH_N(f, p, n) mathStatsPath((f), (p), (n))
+
+#else
+
+  #define MATH_STATS_CALL(f, x) ((void)0)
+  #define MATH_STATS_PATH(f, p) ((void)0)
+  #define MATH_STATS_PATH_N(f, p, n) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+/*
+
+  MulAdd.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_MULADD_C
+#define MATH_MULADD_C
+
+#include "math.h"
+
+
+/*
+
+  MULADD(a,b,c) computes a*b+c and is what every polynomial kernel is built
+  from.
+
+  With a fused multiply-add instruction (see FP_FAST_FMA) it is one instruction
+  and one rounding instead of two of each. Without one, fma has to be done in
+  software, which is far slower than just rounding twice, so it falls back to a
+  plain multiply and add. Kernels are written so that their error bounds hold
+  either way.
+
+*/
+#ifdef FP_FAST_FMA
+  #define MULADD(a,b,c) __builtin_fma((a),(b),(c))
+#else
+  #define MULADD(a,b,c) ((a)*(b)+(c))
+#endif
+
+#ifdef FP_FAST_FMAF
+  #define MULADDF(a,b,c) __builtin_fmaf((a),(b),(c))
+#else
+  #define MULADDF(a,b,c) ((a)*(b)+(c))
+#endif
+
+#endif
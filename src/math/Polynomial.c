@@ -0,0 +1,159 @@
+/*
+
+  Polynomial.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_POLYNOMIAL_C
+#define MATH_POLYNOMIAL_C
+
+#include "math.h"
+#include "math/MulAdd.c"
+
+
+/*
+
+  Polynomial evaluation, shared by every kernel.
+
+  A polynomial is a table of n coefficients in increasing order, so c[0] is the
+  constant term and the polynomial is c[0] + c[1]*x + ... + c[n-1]*x^(n-1).
+  Tables should be static const and n a constant, so that once inlined the
+  loops below unroll into straight line code with nothing left of the table
+  but the constants.
+
+  Three ways to evaluate one:
+
+  Horner:  c[0] + x*(c[1] + x*(c[2] + ...)). n-1 MULADDs, the fewest
+           operations and roundings, but each one waits on the one before, so
+           the time it takes is n-1 times the latency of a MULADD.
+
+  Estrin:  pairs up neighbouring terms, c[0]+c[1]*x, c[2]+c[3]*x, ..., then
+           pairs up those pairs with x^2, those with x^4, and so on. About
+           log2(n) MULADDs deep instead of n-1, at the cost of computing the
+           powers of x and rounding a little differently. Better for long
+           polynomials, where the core has idle units to run the pairs on.
+
+  Mixed:   splits the table into blocks of k coefficients, runs Horner on each
+           block (the blocks are independent, so they overlap), and combines
+           the blocks with Estrin in x^k (k is 2, 4 or 8). In between the two
+           for depth and operation count.
+
+  polynomial() picks between them by length, using the thresholds below. They
+  are the one place to tune for a particular microarchitecture: a core with
+  more FMA units or a longer FMA latency wants Estrin sooner.
+
+  The functions are plain scalar code, with no branches once unrolled, so the
+  batch loops that call them vectorize to whatever width the target has.
+
+*/
+#ifndef POLY_ESTRIN_MIN
+  #define POLY_ESTRIN_MIN 5
+#endif
+
+#ifndef POLY_MIXED_MIN
+  #define POLY_MIXED_MIN 13
+#endif
+
+#ifndef POLY_MIXED_BLOCK
+  #define POLY_MIXED_BLOCK 4
+#endif
+
+#if POLY_MIXED_BLOCK != 2 && POLY_MIXED_BLOCK != 4 && POLY_MIXED_BLOCK != 8
+  #error "POLY_MIXED_BLOCK must be 2, 4 or 8"
+#endif
+
+/*
+
+  Longest table Estrin supports, since it keeps its partial sums in an array.
+  That array is scalarized away once inlined, but GCC counts it against the
+  caller's stack frame while deciding whether to inline, and at 32 doubles two
+  kernels in one small function (a sine and a cosine) were over its limit, so
+  they stayed calls and the batch loops around them didn't vectorize. Every
+  table Estrin is used for is shorter than POLY_MIXED_MIN, so that is all it
+  needs to hold.
+
+*/
+#define POLY_MAX 16
+
+#if POLY_MIXED_MIN - 1 > POLY_MAX
+  #error "POLY_MIXED_MIN is past the longest table Estrin can hold (POLY_MAX)"
+#endif
+
+
+/*
+
+  The evaluators are the same for every type, so they are stamped out by this
+  macro for each floating type with its MULADD. The names get the suffix, like
+  the standard functions (polyHorner for double, polyHornerf for float).
+
+*/
+#define POLY_DEFINE(T, SUFFIX, MULADD_T)                                       \
+                                                                               \
+static inline T polyHorner##SUFFIX(T x, const T *c, int n){                    \
+  T r = c[n-1];                                                                \
+  _Pragma("GCC unroll 32")                                                     \
+  for(int i = n-2; i >= 0; i--){                                               \
+    r = MULADD_T(r, x, c[i]);                                                  \
+  }                                                                            \
+  return r;                                                                    \
+}                                                                              \
+                                                                               \
+/* One step of Estrin: pairs up m partial sums p[] with xp, in place */        \
+static inline void polyEstrinStep##SUFFIX(T *p, int m, T xp){                  \
+  _Pragma("GCC unroll 32")                                                     \
+  for(int i = 0; i < m; i += 2){                                               \
+    p[i/2] = i+1 < m ? MULADD_T(p[i+1], xp, p[i]) : p[i];                      \
+  }                                                                            \
+}                                                                              \
+                                                                               \
+/* Combines m <= POLY_MAX partial sums p[] as a polynomial in xp. The steps    \
+   are written out rather than looped over, since a loop with a halving        \
+   count doesn't get unrolled and would stop the caller from vectorizing. */   \
+static inline T polyEstrinPartials##SUFFIX(T *p, int m, T xp){                 \
+  T xp2 = xp*xp, xp4 = xp2*xp2, xp8 = xp4*xp4, xp16 = xp8*xp8;                 \
+  if(m > 1) polyEstrinStep##SUFFIX(p, m, xp);                                  \
+  if(m > 2) polyEstrinStep##SUFFIX(p, (m+1)/2, xp2);                           \
+  if(m > 4) polyEstrinStep##SUFFIX(p, (m+3)/4, xp4);                           \
+  if(m > 8) polyEstrinStep##SUFFIX(p, (m+7)/8, xp8);                           \
+  if(m > 16) polyEstrinStep##SUFFIX(p, (m+15)/16, xp16);                       \
+  return p[0];                                                                 \
+}                                                                              \
+                                                                               \
+static inline T polyEstrin##SUFFIX(T x, const T *c, int n){                    \
+  T p[POLY_MAX];                                                               \
+  _Pragma("GCC unroll 32")                                                     \
+  for(int i = 0; i < n; i++){                                                  \
+    p[i] = c[i];                                                               \
+  }                                                                            \
+  return polyEstrinPartials##SUFFIX(p, n, x);                                  \
+}                                                                              \
+                                                                               \
+static inline T polyMixed##SUFFIX(T x, const T *c, int n, int k){              \
+  T p[POLY_MAX];                                                               \
+  int m = (n+k-1)/k;                                                           \
+  _Pragma("GCC unroll 32")                                                     \
+  for(int j = 0; j < m; j++){                                                  \
+    int len = n - j*k < k ? n - j*k : k;                                       \
+    p[j] = polyHorner##SUFFIX(x, c + j*k, len);                                \
+  }                                                                            \
+                                                                               \
+  T x2 = x*x, x4 = x2*x2, x8 = x4*x4;                                          \
+  T xk = k == 8 ? x8 : k == 4 ? x4 : x2;                                       \
+                                                                               \
+  return polyEstrinPartials##SUFFIX(p, m, xk);                                 \
+}                                                                              \
+                                                                               \
+static inline T polynomial##SUFFIX(T x, const T *c, int n){                    \
+  if(n >= POLY_MIXED_MIN) return polyMixed##SUFFIX(x, c, n, POLY_MIXED_BLOCK); \
+  if(n >= POLY_ESTRIN_MIN) return polyEstrin##SUFFIX(x, c, n);                 \
+  return polyHorner##SUFFIX(x, c, n);                                          \
+}
+
+POLY_DEFINE(double, , MULADD)
+POLY_DEFINE(float, f, MULADDF)
+
+#endif
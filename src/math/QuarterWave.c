@@ -0,0 +1,151 @@
+/*
+
+  QuarterWave.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_QUARTERWAVE_C
+#define MATH_QUARTERWAVE_C
+
+#include <stdint.h>
+
+
+/*
+
+  sin(i*(pi/2)/256) for i in [0,256], scaled by 2^31 and rounded, so 1.0 is
+  2^31. A quarter of a wave is enough for the whole circle: the other quarters
+  are mirror images, and cos at a table point is sin at the mirrored point.
+
+*/
+_Alignas(64) static const uint32_t QUARTER_WAVE[257] = {
+  0, 13176712, 26352928, 39528151, 52701887, 65873638,
+  79042909, 92209205, 105372028, 118530885, 131685278, 144834714,
+  157978697, 171116733, 184248325, 197372981, 210490206, 223599506,
+  236700388, 249792358, 262874923, 275947592, 289009871, 302061269,
+  315101295, 328129457, 341145265, 354148230, 367137861, 380113669,
+  393075166, 406021865, 418953276, 431868915, 444768294, 457650927,
+  470516330, 483364019, 496193509, 509004318, 521795963, 534567963,
+  547319836, 560051104, 572761285, 585449903, 598116479, 610760536,
+  623381598, 635979190, 648552838, 661102068, 673626408, 686125387,
+  698598533, 711045377, 723465451, 735858287, 748223418, 760560380,
+  772868706, 785147934, 797397602, 809617249, 821806413, 833964638,
+  846091463, 858186435, 870249095, 882278992, 894275671, 906238681,
+  918167572, 930061894, 941921200, 953745043, 965532978, 977284562,
+  988999351, 1000676905, 1012316784, 1023918550, 1035481766, 1047005996,
+  1058490808, 1069935768, 1081340445, 1092704411, 1104027237, 1115308496,
+  1126547765, 1137744621, 1148898640, 1160009405, 1171076495, 1182099496,
+  1193077991, 1204011567, 1214899813, 1225742318, 1236538675, 1247288478,
+  1257991320, 1268646800, 1279254516, 1289814068, 1300325060, 1310787095,
+  1321199781, 1331562723, 1341875533, 1352137822, 1362349204, 1372509294,
+  1382617710, 1392674072, 1402678000, 1412629117, 1422527051, 1432371426,
+  1442161874, 1451898025, 1461579514, 1471205974, 1480777044, 1490292364,
+  1499751576, 1509154322, 1518500250, 1527789007, 1537020244, 1546193612,
+  1555308768, 1564365367, 1573363068, 1582301533, 1591180426, 1599999411,
+  1608758157, 1617456335, 1626093616, 1634669676, 1643184191, 1651636841,
+  1660027308, 1668355276, 1676620432, 1684822463, 1692961062, 1701035922,
+  1709046739, 1716993211, 1724875040, 1732691928, 1740443581, 1748129707,
+  1755750017, 1763304224, 1770792044, 1778213194, 1785567396, 1792854372,
+  1800073849, 1807225553, 1814309216, 1821324572, 1828271356, 1835149306,
+  1841958164, 1848697674, 1855367581, 1861967634, 1868497586, 1874957189,
+  1881346202, 1887664383, 1893911494, 1900087301, 1906191570, 1912224073,
+  1918184581, 1924072871, 1929888720, 1935631910, 1941302225, 1946899451,
+  1952423377, 1957873796, 1963250501, 1968553292, 1973781967, 1978936331,
+  1984016189, 1989021350, 1993951625, 1998806829, 2003586779, 2008291295,
+  2012920201, 2017473321, 2021950484, 2026351522, 2030676269, 2034924562,
+  2039096241, 2043191150, 2047209133, 2051150040, 2055013723, 2058800036,
+  2062508835, 2066139983, 2069693342, 2073168777, 2076566160, 2079885360,
+  2083126254, 2086288720, 2089372638, 2092377892, 2095304370, 2098151960,
+  2100920556, 2103610054, 2106220352, 2108751352, 2111202959, 2113575080,
+  2115867626, 2118080511, 2120213651, 2122266967, 2124240380, 2126133817,
+  2127947206, 2129680480, 2131333572, 2132906420, 2134398966, 2135811153,
+  2137142927, 2138394240, 2139565043, 2140655293, 2141664948, 2142593971,
+  2143442326, 2144209982, 2144896910, 2145503083, 2146028480, 2146473080,
+  2146836866, 2147119825, 2147321946, 2147443222, 2147483648,
+};
+
+
+/*
+
+  pi scaled by 2^29, used to turn the fraction of a table step into radians
+
+*/
+#define QUARTER_WAVE_PI_Q29 1686629713
+
+
+/*
+
+  Returns sin(2*pi*turns/2^32) as a Q1.31 number (2^31 times the value, with
+  +1.0 saturated to INT32_MAX), where turns is a binary fraction of a full
+  circle, so 2^30 is a quarter turn.
+
+  The top two bits give the quadrant and the next eight the table entry a. The
+  other 22 bits are the distance d from it, which is no more than 1/1024 of a
+  turn, so a short Taylor series finishes the job:
+
+    sin(a+d) = sin(a) + cos(a)*d - sin(a)*d^2/2 - cos(a)*d^3/6
+
+  The d^4 term is already below the last bit, and the result is within about
+  one unit of the last bit. There is no floating point anywhere, just table
+  lookups, multiplies and shifts.
+
+*/
+static inline int32_t quarterWaveSinQ31(uint32_t turns){
+  uint32_t quadrant = turns >> 30;
+  uint32_t p = turns & 0x3fffffff;
+
+  // The second and fourth quadrants run backwards through the table
+  if(quadrant & 1) p = 0x40000000 - p;
+
+  uint32_t i = p >> 22;
+  int64_t s = QUARTER_WAVE[i];
+  int64_t c = QUARTER_WAVE[256-i];
+
+  // d in radians, scaled by 2^38 (it is below 2^-7, so this still fits in 31
+  // bits and every product below fits in 63)
+  int64_t d = ((int64_t)(p & 0x3fffff) * QUARTER_WAVE_PI_Q29) >> 22;
+  int64_t d2 = (d*d) >> 38;
+  int64_t d3 = (d2*d) >> 38;
+
+  // Sum the terms with 7 extra bits and round once at the end
+  int64_t v = (s << 7) + ((c*d) >> 31) - ((s*d2) >> 32) - ((c*d3) >> 31) / 6;
+  v = (v + (1 << 6)) >> 7;
+
+  // Only +1.0 is out of range, -1.0 is INT32_MIN
+  if(quadrant & 2) v = -v;
+  if(v > INT32_MAX) v = INT32_MAX;
+  return (int32_t)v;
+}
+
+
+/*
+
+  Returns sin(2*pi*turns/2^16) as a Q1.15 number (with +1.0 saturated to
+  INT16_MAX), where 2^14 turns is a quarter turn.
+
+  Only 15 bits are needed here, so straight-line interpolation between the two
+  nearest table entries is plenty (its error is about a sixth of the last bit).
+
+*/
+static inline int16_t quarterWaveSinQ15(uint16_t turns){
+  uint32_t quadrant = turns >> 14;
+  uint32_t p = turns & 0x3fff;
+
+  if(quadrant & 1) p = 0x4000 - p;
+
+  uint32_t i = p >> 6;
+  int64_t a = QUARTER_WAVE[i];
+  int64_t b = QUARTER_WAVE[i + (i < 256)];
+
+  int64_t v = a + (((b - a) * (p & 63)) >> 6);
+  v = (v + (1 << 15)) >> 16;
+
+  if(quadrant & 2) v = -v;
+  if(v > INT16_MAX) v = INT16_MAX;
+  return (int16_t)v;
+}
+
+#endif
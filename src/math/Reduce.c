@@ -0,0 +1,62 @@
+/*
+
+  Reduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_REDUCE_C
+#define MATH_REDUCE_C
+
+#include "math.h"
+#include "math/DoubleDouble.c"
+
+
+/*
+
+  Number of running results (maxima, minima, sums) the reductions keep. Each
+  lane only ever sees every REDUCE_LANES-th element, so the lanes are
+  independent of one another and fill a couple of vector registers, and the
+  loop isn't held up waiting on the latency of each operation.
+
+  The loop over the lanes is kept from being unrolled. Left as a loop it is
+  vectorized into compares and blends, while unrolled GCC turns it into
+  scalar code with a branch per element.
+
+*/
+#define REDUCE_LANES 8
+
+
+/*
+
+  Compensated summation, for the sums and products of arrays.
+
+  Each lane keeps a sum s and, apart from it, the rounding errors c that
+  adding to s has made, each found exactly by sumError. This is Kahan's idea
+  with Knuth's two-sum in place of the branch Neumaier's variant needs, so
+  nothing depends on the order of magnitude of the terms and the loops still
+  vectorize. reduceAdd adds a term v, and lo, any low part of the term known
+  beyond double precision (the error of a product, say).
+
+  The result is as accurate as if it had been summed in twice the precision
+  and then rounded, unless the sum cancels by more than about 2^53. Where a
+  term or sum is infinite or NaN, the errors are NaN and are dropped, and the
+  plain sum is the result, as for a plain loop.
+
+*/
+static inline void reduceAdd(double *s, double *c, double v, double lo){
+  double t = *s + v;
+  *c += sumError(*s, v, t) + lo;
+  *s = t;
+}
+
+static inline double reduceLanes(const double *s, const double *c){
+  double t = s[0], e = c[0];
+  for(int k = 1; k < REDUCE_LANES; k++) reduceAdd(&t, &e, s[k], c[k]);
+  return __builtin_isfinite(e) ? t + e : t;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+
+  SinKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINKERNEL_C
+#define MATH_SINKERNEL_C
+
+#include "math.h"
+#include "math/CacheLine.c"
+#include "math/MulAdd.c"
+#include "math/Polynomial.c"
+
+
+/*
+
+  Minimax coefficients for sin(x) = x + x^3*(S[0] + S[1]*x^2 + ... + S[5]*x^10)
+  on [-pi/4,pi/4], with an error under 2^-58 (from fdlibm)
+
+*/
+static const double SIN_POLY[6] CACHE_ALIGNED = {
+  -1.66666666666666324348e-01,
+   8.33333333332248946124e-03,
+  -1.98412698298579493134e-04,
+   2.75573137070700676789e-06,
+  -2.50507602534068634195e-08,
+   1.58969099521155010221e-10
+};
+
+
+/*
+
+  Returns sin(x+y) for |x+y| <= pi/4, where y is the tail left over by range
+  reduction (pass 0 if there is none).
+
+  The x^3 term is added on its own at the end, where its rounding error counts
+  least. The other five go through the shared evaluator.
+
+  The first order effect of the tail is sin(x+y) ~ sin(x) + y*cos(x), and
+  cos(x) ~ 1 - x^2/2 is plenty for how small y is.
+
+*/
+static inline double sinKernel(double x, double y){
+  double z = x*x;
+  double v = z*x;
+
+  double r = polynomial(z, SIN_POLY+1, 5);
+
+  return x - (MULADD(z, MULADD(-v, r, 0.5*y), -y) - v*SIN_POLY[0]);
+}
+
+#endif
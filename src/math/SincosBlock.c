@@ -0,0 +1,95 @@
+/*
+
+  SincosBlock.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINCOSBLOCK_C
+#define MATH_SINCOSBLOCK_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/TrigReduce.c"
+#include "math/SincosKernel.c"
+
+
+/*
+
+  Number of elements worked on at once. Large enough to fill the widest vector
+  registers a couple of times over, small enough that the gathered block stays
+  in L1.
+
+*/
+#define SINCOS_BLOCK 32
+
+
+/*
+
+  Computes sin and cos of count (<= SINCOS_BLOCK) contiguous arguments.
+
+  The loop only uses the branch-free Cody-Waite reduction, so the compiler can
+  vectorize it. Arguments that need more than that (huge, infinite or NaN) are
+  noted on the way and redone one at a time afterwards, which costs nothing
+  when there are none.
+
+  Tiny arguments (below TRIG_TINY) get sin x = x and cos x = 1, like the
+  scalar functions. The kernels run on 0 in their place and their results are
+  selected away, since on tiny arguments they would underflow into subnormals.
+
+  With MATH_STATS every element counts as one call.
+
+*/
+static inline void sincosBlock(const double *x, double *sinx, double *cosx,
+                               size_t count){
+  int slow = 0;
+
+#ifdef MATH_STATS
+  for(size_t i = 0; i < count; i++){
+    MATH_STATS_CALL(MATH_STATS_SINCOS_BATCH, x[i]);
+  }
+  size_t medium = count;
+  for(size_t i = 0; i < count; i++){
+    if(!(__builtin_fabs(x[i]) < TRIG_TINY)) continue;
+    MATH_STATS_PATH(MATH_STATS_SINCOS_BATCH, MATH_STATS_PATH_TINY);
+    medium--;
+  }
+#endif
+
+  for(size_t i = 0; i < count; i++){
+    uint64_t tiny = __builtin_fabs(x[i]) < TRIG_TINY;
+    double y0, y1, s, c;
+    int n = trigReduceMedium(selectDouble(tiny, 0, x[i]), &y0, &y1);
+    sincosQuadrant(n, y0, y1, &s, &c);
+    sinx[i] = selectDouble(tiny, x[i], s);
+    cosx[i] = selectDouble(tiny, 1.0, c);
+    slow |= !(__builtin_fabs(x[i]) < TRIG_REDUCE_MEDIUM);
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(__builtin_fabs(x[i]) < TRIG_REDUCE_MEDIUM) continue;
+
+#ifdef MATH_STATS
+      medium--;
+#endif
+      if(x[i] - x[i] != 0){
+        MATH_STATS_PATH(MATH_STATS_SINCOS_BATCH, MATH_STATS_PATH_SPECIAL);
+        sinx[i] = cosx[i] = x[i] - x[i];
+        continue;
+      }
+
+      MATH_STATS_PATH(MATH_STATS_SINCOS_BATCH, MATH_STATS_PATH_LARGE);
+      double y0, y1;
+      int n = trigReduceLarge(x[i], &y0, &y1);
+      sincosQuadrant(n, y0, y1, &sinx[i], &cosx[i]);
+    }
+  }
+
+  MATH_STATS_PATH_N(MATH_STATS_SINCOS_BATCH, MATH_STATS_PATH_MEDIUM, medium);
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+
+  SincosKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINCOSKERNEL_C
+#define MATH_SINCOSKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/SinKernel.c"
+#include "math/CosKernel.c"
+
+
+/*
+
+  Given the quadrant n and reduced argument y0+y1 from trigReduce, stores sin
+  and cos of the original argument.
+
+  Each quadrant is sin or cos of the reduced argument, swapped in odd quadrants
+  and negated in the left (cos) or lower (sin) half of the circle. Both kernels
+  are always evaluated and the right ones picked with selects rather than a
+  switch, so that loops calling this vectorize.
+
+*/
+static inline void sincosQuadrant(int n, double y0, double y1,
+                                  double *sinx, double *cosx){
+  double s = sinKernel(y0, y1);
+  double c = cosKernel(y0, y1);
+
+  double sv = (n & 1) ? c : s;
+  double cv = (n & 1) ? s : c;
+
+  *sinx = (n & 2) ? -sv : sv;
+  *cosx = ((n+1) & 2) ? -cv : cv;
+}
+
+
+/*
+
+  Returns sin(x) for x = n*(pi/2) + y0 + y1 with y0+y1 in [-pi/4,pi/4], without
+  branches: both kernels run and the quadrant picks between them, as in sinpi.
+  cos(x) is the same with n one more.
+
+*/
+static inline double trigQuadrant(uint64_t n, double y0, double y1){
+  double s = sinKernel(y0, y1);
+  double c = cosKernel(y0, y1);
+  double y = selectDouble(n & 1, c, s);
+  return selectDouble(n & 2, -y, y);
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+
+  Sqrt.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SQRT_C
+#define MATH_SQRT_C
+
+#include "math.h"
+
+#if !defined(__NO_MATH_ERRNO__) && (defined(__SSE2__) || defined(_M_X64))
+  #include <emmintrin.h>
+#endif
+
+
+/*
+
+  The square root instruction, for kernels that take the square root of a
+  number they know is nonnegative.
+
+  __builtin_sqrt is that instruction, but when math errno is on it also tests
+  for a negative argument and calls sqrt to set errno, which is a call out of
+  the kernel and a branch that keeps loops from vectorizing. So it is used as
+  is only when built with -fno-math-errno, and on x86 otherwise the SSE2
+  instruction is reached through its intrinsic, which never calls anything
+  (but doesn't vectorize either). Elsewhere the builtin is all there is.
+
+*/
+static inline double squareRoot(double x){
+#if !defined(__NO_MATH_ERRNO__) && (defined(__SSE2__) || defined(_M_X64))
+  __m128d v = _mm_set_sd(x);
+  return _mm_cvtsd_f64(_mm_sqrt_sd(v, v));
+#else
+  return __builtin_sqrt(x);
+#endif
+}
+
+#endif
@@ -0,0 +1,32 @@
+/*
+
+  TrigBoundedKernel.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_TRIGBOUNDEDKERNEL_C
+#define MATH_TRIGBOUNDEDKERNEL_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/TrigReduce.c"
+#include "math/SincosKernel.c"
+
+
+/*
+
+  Body of sin_bounded and cos_bounded, shared with their batch forms
+
+*/
+static inline double trigBoundedCore(double x, uint64_t cosine){
+  double y0, y1;
+  uint64_t n = trigReduceBounded(x, &y0, &y1);
+  return trigQuadrant(n + cosine, y0, y1);
+}
+
+#endif
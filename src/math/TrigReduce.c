@@ -0,0 +1,247 @@
+/*
+
+  TrigReduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_TRIGREDUCE_C
+#define MATH_TRIGREDUCE_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/CacheLine.c"
+#include "math/FloatBits.c"
+#include "math/MulAdd.c"
+#include "math/FusedMultiplyAdd.c"
+#include "math/MathStats.c"
+
+
+/*
+
+  pi/2 split into pieces of 33 bits, each followed by the tail of what is left
+  (from fdlibm). Multiplying one of the 33 bit pieces by a quadrant count below
+  2^20 is exact.
+
+*/
+static const double INVPIO2 = 6.36619772367581382433e-01;
+static const double PIO2_1  = 1.57079632673412561417e+00;
+static const double PIO2_2  = 6.07710050630396597660e-11;
+static const double PIO2_2T = 2.02226624879595063154e-21;
+
+/*
+
+  pi/4, below which no reduction is needed
+
+*/
+static const double PIO4 = 7.85398163397448278999e-01;
+
+/*
+
+  pi/2 as a double plus the error of that double
+
+*/
+static const double PIO2_HI = 1.57079632679489655800e+00;
+static const double PIO2_LO = 6.12323399573676603587e-17;
+
+/*
+
+  Largest magnitude reduced the quick way. Past this the quadrant count no
+  longer fits in the 20 bits the split above relies on.
+
+*/
+#define TRIG_REDUCE_MEDIUM 0x1p20
+
+
+/*
+
+  Below TRIG_TINY, sin(x) and tan(x) round to x and cos(x) rounds to 1, so the
+  trig functions return those straight away. Besides skipping the kernels, this
+  stops x*x from underflowing to a subnormal, which can cost a microcode assist
+  of a hundred cycles or more on x86.
+
+*/
+#define TRIG_TINY 0x1p-27
+
+
+/*
+
+  Bits of 2/pi, most significant first, with a zero word in front so that
+  windows starting just before the binary point can be read the same way as
+  every other window. 1536 bits is enough for the largest double.
+
+*/
+static const uint64_t TWO_OVER_PI[25] CACHE_ALIGNED = {
+  0,
+  0xA2F9836E4E441529, 0xFC2757D1F534DDC0, 0xDB6295993C439041,
+  0xFE5163ABDEBBC561, 0xB7246E3A424DD2E0, 0x06492EEA09D1921C,
+  0xFE1DEB1CB129A73E, 0xE88235F52EBB4484, 0xE99C7026B45F7E41,
+  0x3991D639835339F4, 0x9C845F8BBDF9283B, 0x1FF897FFDE05980F,
+  0xEF2F118B5A0A6D1F, 0x6D367ECF27CB09B7, 0x4F463F669E5FEA2D,
+  0x7527BAC7EBE5F17B, 0x3D0739F78A5292EA, 0x6BFB5FB11F8D5D08,
+  0x56033046FC7B6BAB, 0xF0CFBC209AF4361D, 0xA9E391615EE61B08,
+  0x6599855F14A06840, 0x8DFFD8804D732731, 0x06061556CA73A8C9,
+};
+
+
+/*
+
+  Returns 64 bits of 2/pi starting at bit p, where bit 0 is the first bit after
+  the binary point. p may be as low as -64, bits before the point are zero.
+
+*/
+static inline uint64_t twoOverPiBits(int p){
+  int word = (p >> 6) + 1;
+  int shift = p & 63;
+  uint64_t bits = TWO_OVER_PI[word] << shift;
+  if(shift) bits |= TWO_OVER_PI[word+1] >> (64-shift);
+  return bits;
+}
+
+
+/*
+
+  Reduction for |x| >= TRIG_REDUCE_MEDIUM (Payne-Hanek).
+
+  Write x = m*2^k with m a 53 bit integer. Only x*(2/pi) mod 4 matters, and
+  since m is an integer, bits of 2^k*(2/pi) worth 4 or more can't change that.
+  So only a 192 bit window of 2/pi starting just above the 2s place is needed,
+  no matter how large x is. The product m*window gives the quadrant in its top
+  two bits and the position inside the quadrant in the rest.
+
+*/
+static int trigReduceLarge(double x, double *y0, double *y1){
+  uint64_t bits = doubleToBits(x);
+  int k = (int)((bits >> 52) & 0x7ff) - 1075;
+  uint64_t m = (bits & ((1ull<<52)-1)) | (1ull<<52);
+
+  // Window of 2/pi whose last bit is worth 2^-190 after scaling by 2^k
+  int p = k-2;
+  uint64_t w0 = twoOverPiBits(p);
+  uint64_t w1 = twoOverPiBits(p+64);
+  uint64_t w2 = twoOverPiBits(p+128);
+
+  // 192 bit product m*window, anything above 192 bits is a multiple of 4
+  unsigned __int128 p2 = (unsigned __int128)m*w2;
+  unsigned __int128 p1 = (unsigned __int128)m*w1;
+  uint64_t l0 = (uint64_t)p2;
+  uint64_t l1 = (uint64_t)(p2>>64) + (uint64_t)p1;
+  uint64_t l2 = (uint64_t)(p1>>64) + m*w0 + (l1 < (uint64_t)p1);
+
+  int n = l2 >> 62;
+
+  // 128 bits of fraction, as a signed distance to the nearest quadrant
+  unsigned __int128 f = ((unsigned __int128)((l2<<2) | (l1>>62)) << 64)
+                      | ((l1<<2) | (l0>>62));
+  __int128 sf = (__int128)f;
+  if(sf < 0) n++;
+
+  // Fraction as a double-double, in quarter turns
+  double hi = (double)sf;
+  double lo = (double)(sf - (__int128)hi);
+  hi *= 0x1p-128;
+  lo *= 0x1p-128;
+
+  // Multiply by pi/2 keeping the rounding error of the leading product
+  double rh = hi*PIO2_HI;
+  double rl = fusedMultiplyAdd(hi, PIO2_HI, -rh) + (hi*PIO2_LO + lo*PIO2_HI);
+
+  *y0 = rh + rl;
+  *y1 = rl - (*y0 - rh);
+
+  if(x < 0){
+    *y0 = -*y0;
+    *y1 = -*y1;
+    n = -n;
+  }
+  return n & 3;
+}
+
+
+/*
+
+  Cody-Waite half of trigReduce, for |x| < TRIG_REDUCE_MEDIUM only.
+
+  n is found by rounding x*(2/pi) to the nearest integer, and n*(pi/2) is
+  subtracted in three pieces so that the cancellation between x and n*(pi/2)
+  doesn't eat into the precision of the result. The pieces are subtracted with
+  MULADD, so with FMA each step is a single instruction.
+
+  There are no branches in here, so loops over arrays of arguments that call it
+  can be vectorized.
+
+*/
+static inline int trigReduceMedium(double x, double *y0, double *y1){
+
+  // Adding 1.5*2^52 rounds to the nearest integer in the current rounding mode
+  double fn = x*INVPIO2 + 0x1.8p52;
+  fn -= 0x1.8p52;
+  int n = (int)fn;
+
+  double t = MULADD(-fn, PIO2_1, x);
+  double w = fn*PIO2_2;
+  double r = t - w;
+  w = MULADD(fn, PIO2_2T, -((t - r) - w));
+
+  *y0 = r - w;
+  *y1 = (r - *y0) - w;
+
+  return n & 3;
+}
+
+
+/*
+
+  Reduction for |x| <= pi only, for the bounded entry points (trig_bounded.c).
+
+  n is at most 2 there, so n*PIO2_HI is exact, and so is x - n*PIO2_HI, since
+  whenever n is nonzero x is within a factor of two of n*(pi/2). That leaves
+  only n*PIO2_LO, itself exact, to subtract with its rounding error kept, which
+  is about half the work of trigReduceMedium. n is read from the low bits of
+  the rounding sum, as in halfTurnReduce, so everything stays in 64 bit lanes.
+
+*/
+static inline uint64_t trigReduceBounded(double x, double *y0, double *y1){
+  double fn = MULADD(x, INVPIO2, 0x1.8p52);
+  uint64_t n = doubleToBits(fn);
+  fn -= 0x1.8p52;
+
+  double r = x - fn*PIO2_HI;
+  double w = fn*PIO2_LO;
+
+  *y0 = r - w;
+  *y1 = (r - *y0) - w;
+
+  return n & 3;
+}
+
+
+/*
+
+  Reduces x to y0+y1 in [-pi/4,pi/4] such that x = n*(pi/2) + y0 + y1, and
+  returns n mod 4, the quadrant x is in.
+
+  This is shared by every trig function, so they all agree on where quadrant
+  boundaries lie. x must be finite.
+
+*/
+static inline int trigReduce(double x, double *y0, double *y1){
+  if(!(__builtin_fabs(x) < TRIG_REDUCE_MEDIUM)){
+    return trigReduceLarge(x, y0, y1);
+  }
+  return trigReduceMedium(x, y0, y1);
+}
+
+
+/*
+
+  The path through trigReduce that finite x takes, for MATH_STATS_PATH
+
+*/
+#define TRIG_REDUCE_PATH(x) (__builtin_fabs(x) < TRIG_REDUCE_MEDIUM ? \
+                             MATH_STATS_PATH_MEDIUM : MATH_STATS_PATH_LARGE)
+
+#endif
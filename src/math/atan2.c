@@ -0,0 +1,32 @@
+/*
+
+  atan2.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_ATAN2_C
+#define MATH_ATAN2_C
+
+#include "math.h"
+#include "math/AtanKernel.c"
+
+
+/*
+
+  Returns the angle of the point (x, y) from the positive x axis, in
+  [-pi,pi].
+
+  Infinities and zeros are mapped to finite points at the same angle (see
+  atan2Core). No error is reported for two zeros, which Annex F gives results
+  for.
+
+*/
+double atan2(double y, double x){
+  return atan2Core(y, x);
+}
+
+#endif
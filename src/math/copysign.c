@@ -0,0 +1,50 @@
+/*
+
+  copysign.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_COPYSIGN_C
+#define MATH_COPYSIGN_C
+
+#include "math.h"
+#include <float.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/Exponent.c"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h. copysign combines
+  the sign bit of y with the other bits of x.
+
+  The bits are moved by hand: GCC takes __builtin_copysign inside copysign
+  itself for a call to copysign, and warns of infinite recursion.
+
+*/
+double copysign(double x, double y){
+  uint64_t sign = 1ull << 63;
+  return bitsToDouble((doubleToBits(x) & ~sign) | (doubleToBits(y) & sign));
+}
+
+float copysignf(float x, float y){
+  uint32_t sign = 1u << 31;
+  return bitsToFloat((floatToBits(x) & ~sign) | (floatToBits(y) & sign));
+}
+
+long double copysignl(long double x, long double y){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return copysign(x, y);
+#else
+  union longDoubleBits u = { x }, v = { y };
+  LDBL_SET_SE(u, (LDBL_SE(u) & 0x7fff) | (LDBL_SE(v) & 0x8000));
+  return u.f;
+#endif
+}
+
+#endif
@@ -8,8 +8,15 @@
 
 */
 
+#ifndef MATH_COS_C
+#define MATH_COS_C
+
 #include "math.h"
-#include "math/CosTaylorSeries.c"
+#include "math/TrigReduce.c"
+#include "math/MathErrno.c"
+#include "math/SinKernel.c"
+#include "math/CosKernel.c"
+#include "math/FloatTrigKernel.c"
 
 
 /*
@@ -20,16 +27,56 @@
   https://github.com/lougehrig10/C-Standard-Library/wiki/cos_
 
 */
-double cos(double x){
+__MATH_NOCLONE double cos(double x){
+  MATH_STATS_CALL(MATH_STATS_COS, x);
+
+  if(__builtin_fabs(x) < TRIG_TINY){
+    MATH_STATS_PATH(MATH_STATS_COS, MATH_STATS_PATH_TINY);
+    return 1.0;
+  }
+
+  // Close enough to zero that no reduction is needed
+  if(__builtin_fabs(x) <= PIO4){
+    MATH_STATS_PATH(MATH_STATS_COS, MATH_STATS_PATH_SMALL);
+    return cosKernel(x, 0);
+  }
 
-  // Mathematically identical to -1^(floor(x+pi/2)/pi)
-  int flip = (((int)((x+M_PI/2)/M_PI))%2 ? -1 : 1);
+  // cos of infinity or NaN is NaN, and infinity is a domain error
+  if(x - x != 0){
+    MATH_STATS_PATH(MATH_STATS_COS, MATH_STATS_PATH_SPECIAL);
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+  MATH_STATS_PATH(MATH_STATS_COS, TRIG_REDUCE_PATH(x));
 
   /*
-    Shift input left a quarter of a circle, take half a circle, then shift back
-    This gives us the bottom half of the circle.
+    Find which quarter of the circle x is in, and how far it is from the
+    middle of that quarter. Each quarter is then either cos or sin of that
+    distance, with the sign flipped in the left half of the circle.
   */
-  x=fmod(x+M_PI/2,M_PI)-M_PI/2;
+  double y0, y1;
+  switch(trigReduce(x, &y0, &y1)){
+    case 0: return cosKernel(y0, y1);
+    case 1: return -sinKernel(y0, y1);
+    case 2: return -cosKernel(y0, y1);
+    default: return sinKernel(y0, y1);
+  }
+}
+
+
 
-  return flip*cosTaylorSeries(x);
+/*
+
+  float version of cos, evaluated in double precision with the shorter kernels
+  of FloatTrigKernel.c and rounded once at the end
+
+*/
+__MATH_NOCLONE float cosf(float x){
+  if(x - x != 0){
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+  return (float)trigFloat(x, 1);
 }
+
+#endif
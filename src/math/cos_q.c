@@ -0,0 +1,41 @@
+/*
+
+  cos_q.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_COS_Q_C
+#define MATH_COS_Q_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/QuarterWave.c"
+
+
+/*
+
+  Cosine of an angle given as a binary fraction of a full turn, in the same
+  forms as sin_q32, sin_q16 and sinf_q32.
+
+  cos is sin a quarter turn ahead, and a quarter turn is exactly 2^30 (or 2^14)
+  so the shift is free of rounding. Wrapping past a full turn is just unsigned
+  overflow.
+
+*/
+int32_t cos_q32(uint32_t turns){
+  return quarterWaveSinQ31(turns + 0x40000000u);
+}
+
+int16_t cos_q16(uint16_t turns){
+  return quarterWaveSinQ15((uint16_t)(turns + 0x4000u));
+}
+
+float cosf_q32(uint32_t turns){
+  return quarterWaveSinQ31(turns + 0x40000000u) * 0x1p-31f;
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+
+  cospi.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_COSPI_C
+#define MATH_COSPI_C
+
+#include "math.h"
+#include "math/HalfTurnKernel.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Computes cos(pi*t), that is, the cosine of t measured in half turns.
+
+  Cheaper and more accurate than cos(M_PI*t), since no inexact pi is involved
+  until the argument is already reduced. cospi(n+1/2) is +0 for every whole
+  number n.
+
+*/
+double cospi(double t){
+  if(__builtin_fabs(t) < HALF_TURN_TINY){
+    return 1.0;
+  }
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return cospiCore(t);
+}
+
+
+/*
+
+  float version of cospi, evaluated in double precision and rounded once
+
+*/
+float cospif(float t){
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return (float)cospiCore(t);
+}
+
+#endif
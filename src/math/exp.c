@@ -0,0 +1,51 @@
+/*
+
+  exp.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_EXP_C
+#define MATH_EXP_C
+
+#include "math.h"
+#include <float.h>
+#include "math/MathErrno.c"
+#include "math/ExpKernel.c"
+
+
+/*
+
+  Returns e^x.
+
+  A range error occurs if the result overflows, or underflows to a subnormal
+  or zero. e^(-inf) is exactly zero and e^(+inf) infinite, with no error.
+
+*/
+__MATH_NOCLONE double exp(double x){
+  if(!__builtin_isfinite(x)) return x == -HUGE_VAL ? 0 : x + x;
+
+  double r = expKernel(x);
+  if(r == HUGE_VAL || r < DBL_MIN) SET_ERRNO(ERANGE);
+  return r;
+}
+
+
+/*
+
+  float version of exp, from the same kernel in double precision, rounded
+  once. Overflow and underflow are those of the float result.
+
+*/
+float expf(float x){
+  if(!__builtin_isfinite(x)) return x == -HUGE_VALF ? 0 : x + x;
+
+  float r = (float)expKernel(x);
+  if(r == HUGE_VALF || r < FLT_MIN) SET_ERRNO(ERANGE);
+  return r;
+}
+
+#endif
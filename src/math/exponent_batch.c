@@ -0,0 +1,162 @@
+/*
+
+  exponent_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_EXPONENT_BATCH_C
+#define MATH_EXPONENT_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/Exponent.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Number of elements worked on at once. The arguments of a block are kept
+  while the outputs are written, so the functions can work in place.
+
+*/
+#define EXPONENT_BLOCK 64
+
+
+/*
+
+  Each block is one loop over the normal-number case, which is nothing but
+  integer operations and vectorizes. Zeros, subnormals, infinities and NaNs
+  are noted on the way and redone afterwards, as in sincosBlock.
+
+*/
+static inline void frexpBlock(const double *x, double *m, int *e,
+                              size_t count){
+  double in[EXPONENT_BLOCK];
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    in[i] = x[i];
+    slow |= !doubleIsNormal(in[i]);
+    m[i] = frexpNormal(in[i], &e[i]);
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(!doubleIsNormal(in[i])) m[i] = frexpSlow(in[i], &e[i]);
+    }
+  }
+}
+
+static inline void ldexpBlock(const double *x, const int *e, double *y,
+                              size_t count){
+  double in[EXPONENT_BLOCK];
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    in[i] = x[i];
+    slow |= !(doubleIsNormal(in[i]) & scaleStaysNormal(in[i], e[i]));
+    y[i] = scaleNormal(in[i], e[i]);
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(doubleIsNormal(in[i]) & scaleStaysNormal(in[i], e[i])) continue;
+      y[i] = scalbnSlow(in[i], e[i]);
+    }
+  }
+}
+
+static inline void ilogbBlock(const double *x, int *y, size_t count){
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    slow |= !doubleIsNormal(x[i]);
+    y[i] = (int)doubleExponent(x[i]) - 0x3ff;
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(!doubleIsNormal(x[i])) y[i] = ilogbSlow(x[i]);
+    }
+  }
+}
+
+static inline void logbBlock(const double *x, double *y, size_t count){
+  double in[EXPONENT_BLOCK];
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    in[i] = x[i];
+    slow |= !doubleIsNormal(in[i]);
+    y[i] = (int)doubleExponent(in[i]) - 0x3ff;
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(!doubleIsNormal(in[i])) y[i] = logbSlow(in[i]);
+    }
+  }
+}
+
+
+/*
+
+  Compute m[i] = frexp(x[i], &e[i]), y[i] = ldexp(x[i], e[i]),
+  y[i] = ilogb(x[i]) and y[i] = logb(x[i]) for i in [0,n)
+
+*/
+void frexp_batch(const double *x, double *m, int *e, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i += EXPONENT_BLOCK){
+    size_t count = n-i < EXPONENT_BLOCK ? n-i : EXPONENT_BLOCK;
+    frexpBlock(x+i, m+i, e+i, count);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void ldexp_batch(const double *x, const int *e, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i += EXPONENT_BLOCK){
+    size_t count = n-i < EXPONENT_BLOCK ? n-i : EXPONENT_BLOCK;
+    ldexpBlock(x+i, e+i, y+i, count);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void ilogb_batch(const double *x, int *y, size_t n){
+  for(size_t i = 0; i < n; i += EXPONENT_BLOCK){
+    size_t count = n-i < EXPONENT_BLOCK ? n-i : EXPONENT_BLOCK;
+    ilogbBlock(x+i, y+i, count);
+  }
+}
+
+void logb_batch(const double *x, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i += EXPONENT_BLOCK){
+    size_t count = n-i < EXPONENT_BLOCK ? n-i : EXPONENT_BLOCK;
+    logbBlock(x+i, y+i, count);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+
+/*
+
+  Computes frac[i] = modf(x[i], &ip[i]) for i in [0,n). modf has no slow
+  cases, so this is a plain loop over its branch-free body.
+
+*/
+void modf_batch(const double *x, double *frac, double *ip, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    double v = x[i];
+    frac[i] = modfCore(v, &ip[i]);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+#endif
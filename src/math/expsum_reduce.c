@@ -0,0 +1,58 @@
+/*
+
+  expsum_reduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_EXPSUM_REDUCE_C
+#define MATH_EXPSUM_REDUCE_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/ExpKernel.c"
+#include "math/FlushSubnormals.c"
+#include "math/Reduce.c"
+
+
+/*
+
+  Returns e^x[0] + ... + e^x[n-1], such as the denominator of a softmax.
+
+  Each exponential is computed and added in the same pass, without an array
+  in between, into the compensated sums of Reduce.c. expKernel has no
+  branches and takes infinities and NaNs as they are (e^-inf is 0), so there
+  is nothing to redo afterwards.
+
+  The sum overflows once it passes the largest double. For a softmax, the
+  usual remedy applies: subtract the largest element (fmax_reduce) from each
+  before exponentiating, which leaves the ratios as they were. No errno is
+  set.
+
+*/
+double expsum_reduce(const double *x, size_t n){
+  double s[REDUCE_LANES], c[REDUCE_LANES];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(int k = 0; k < REDUCE_LANES; k++) s[k] = c[k] = 0;
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int k = 0; k < REDUCE_LANES; k++){
+      reduceAdd(&s[k], &c[k], expKernel(x[i+k]), 0);
+    }
+  }
+  for(int k = 0; i < n; i++, k++){
+    reduceAdd(&s[k], &c[k], expKernel(x[i]), 0);
+  }
+
+  double r = reduceLanes(s, c);
+  flushSubnormalsEnd(flush);
+  return r;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+
+  fabs.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FABS_C
+#define MATH_FABS_C
+
+#include "math.h"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h. fabs clears the sign
+  bit.
+
+*/
+double fabs(double x){
+  return __builtin_fabs(x);
+}
+
+float fabsf(float x){
+  return __builtin_fabsf(x);
+}
+
+long double fabsl(long double x){
+  return __builtin_fabsl(x);
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+
+  fdim.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FDIM_C
+#define MATH_FDIM_C
+
+#include "math.h"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h
+
+*/
+double fdim(double x, double y){
+  return __math_fdim(x, y);
+}
+
+float fdimf(float x, float y){
+  return __math_fdimf(x, y);
+}
+
+long double fdiml(long double x, long double y){
+  return __math_fdiml(x, y);
+}
+
+#endif
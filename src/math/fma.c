@@ -0,0 +1,179 @@
+/*
+
+  fma.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FMA_C
+#define MATH_FMA_C
+
+#include "math.h"
+#include <float.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/FusedMultiplyAdd.c"
+
+
+/*
+
+  Computes (x*y)+z rounded once.
+
+  When the target has a fused multiply-add instruction (FP_FAST_FMA) this is
+  that single instruction, otherwise the exact software version in
+  FusedMultiplyAdd.c.
+
+*/
+double fma(double x, double y, double z){
+  return fusedMultiplyAdd(x, y, z);
+}
+
+
+#ifndef FP_FAST_FMAF
+
+/*
+
+  Nudges s one unit in the last place towards the exact value s+err when s is
+  inexact and its last bit is even. The result is s rounded to odd, which can
+  then be rounded to any format at least two bits narrower without the double
+  rounding problem.
+
+*/
+static double roundToOdd(double s, double err){
+  uint64_t bits = doubleToBits(s);
+  if(err != 0 && !(bits & 1)){
+    bits += ((err > 0) == (s > 0)) ? 1 : -1;
+  }
+  return bitsToDouble(bits);
+}
+
+#endif
+
+
+/*
+
+  float version of fma. The product of two floats is exact in a double, and the
+  sum is carried to double precision, rounded to odd, and then rounded to float.
+
+*/
+float fmaf(float x, float y, float z){
+#ifdef FP_FAST_FMAF
+  return fusedMultiplyAddf(x, y, z);
+#else
+  double p = (double)x*y;
+  double s = p + z;
+
+  if(s - s != 0) return s; // Infinite or NaN
+
+  // Two-sum, err is exactly the part of p+z that did not fit into s
+  double bb = s - p;
+  double err = (p - (s - bb)) + (z - bb);
+
+  return roundToOdd(s, err);
+#endif
+}
+
+
+#if LDBL_MANT_DIG != DBL_MANT_DIG && !defined(FP_FAST_FMAL)
+
+/*
+
+  Long double counterpart of roundToOdd. Handles the 64 bit significand x87
+  format (which has an explicit leading bit) and IEEE binary128.
+
+*/
+static long double roundToOddl(long double s, long double err){
+  if(err == 0) return s;
+  int up = (err > 0) == (s > 0);
+
+#if LDBL_MANT_DIG == 64
+  union { long double f; struct { uint64_t m; uint16_t se; } i; } u = { s };
+  if(u.i.m & 1) return s;
+  if(up){
+    if(++u.i.m == 0){
+      u.i.m = 1ull<<63;
+      u.i.se++;
+    }
+  }else{
+    if(u.i.m == 1ull<<63 && (u.i.se & 0x7fff) > 1){
+      u.i.m = ~0ull;
+      u.i.se--;
+    }else{
+      u.i.m--;
+    }
+  }
+#else
+  union { long double f; struct { uint64_t lo, hi; } i; } u = { s };
+  if(u.i.lo & 1) return s;
+  if(up){
+    u.i.hi += (++u.i.lo == 0);
+  }else{
+    u.i.hi -= (u.i.lo-- == 0);
+  }
+#endif
+
+  return u.f;
+}
+
+
+/*
+
+  Splits x into two halves of at most half the significand width, so the
+  product of any two halves is exact (Veltkamp splitting)
+
+*/
+static void splitl(long double x, long double *hi, long double *lo){
+  const long double c = (1ull << ((LDBL_MANT_DIG+1)/2)) + 1.0L;
+  long double t = c*x;
+  *hi = t - (t - x);
+  *lo = x - *hi;
+}
+
+#endif
+
+
+/*
+
+  long double version of fma.
+
+  Without an instruction or a wider type to fall back on, the product is
+  formed exactly as a sum of two long doubles (Dekker), z is added with an
+  exact two-sum, and the low parts are combined with rounding to odd before the
+  final addition, following Boldo and Melquiond. This is correctly rounded as
+  long as x*y neither overflows nor underflows.
+
+*/
+long double fmal(long double x, long double y, long double z){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return fusedMultiplyAdd(x, y, z);
+#elif defined(FP_FAST_FMAL)
+  return __builtin_fmal(x, y, z);
+#else
+  long double xh, xl, yh, yl;
+
+  long double ph = x*y;
+  if(ph - ph != 0 || z - z != 0 || ph == 0) return x*y + z;
+
+  splitl(x, &xh, &xl);
+  splitl(y, &yh, &yl);
+  long double pl = ((xh*yh - ph) + xh*yl + xl*yh) + xl*yl;
+
+  // (sh, sl) = z + ph exactly
+  long double sh = z + ph;
+  long double bb = sh - z;
+  long double sl = (z - (sh - bb)) + (ph - bb);
+
+  // v = pl + sl rounded to odd
+  long double v = pl + sl;
+  bb = v - pl;
+  long double verr = (pl - (v - bb)) + (sl - bb);
+  v = roundToOddl(v, verr);
+
+  return sh + v;
+#endif
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+
+  fmax.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FMAX_C
+#define MATH_FMAX_C
+
+#include "math.h"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h
+
+*/
+double fmax(double x, double y){
+  return __math_fmax(x, y);
+}
+
+float fmaxf(float x, float y){
+  return __math_fmaxf(x, y);
+}
+
+long double fmaxl(long double x, long double y){
+  return __math_fmaxl(x, y);
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+
+  fmax_reduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FMAX_REDUCE_C
+#define MATH_FMAX_REDUCE_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/Reduce.c"
+
+
+/*
+
+  Returns the largest of x[0] to x[n-1], ignoring NaNs as fmax does.
+
+  The lanes start out as NaN, which fmax replaces with the first number that
+  comes along, so there is no special first element and the result is NaN
+  only when n is 0 or every element is a NaN. The lanes are combined with
+  fmax at the end, and since the maximum doesn't depend on the order in which
+  elements are compared (short of the sign of zero), that is the same as one
+  pass over the array.
+
+  Unlike the other batch functions these don't flush subnormals even when
+  math_flush_subnormals is on. They do no arithmetic to speed up, and with
+  denormals-are-zero every subnormal compares equal to 0 and to every other,
+  so which one came out would depend on the order of the elements.
+
+*/
+double fmax_reduce(const double *x, size_t n){
+  double lane[REDUCE_LANES];
+
+  for(int k = 0; k < REDUCE_LANES; k++) lane[k] = __builtin_nan("");
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int k = 0; k < REDUCE_LANES; k++){
+      lane[k] = __math_fmax(x[i+k], lane[k]);
+    }
+  }
+  for(int k = 0; i < n; i++, k++){
+    lane[k] = __math_fmax(lane[k], x[i]);
+  }
+
+  double m = lane[0];
+  for(int k = 1; k < REDUCE_LANES; k++) m = __math_fmax(m, lane[k]);
+
+  return m;
+}
+
+
+/*
+
+  Returns the smallest of x[0] to x[n-1], ignoring NaNs as fmin does
+
+*/
+double fmin_reduce(const double *x, size_t n){
+  double lane[REDUCE_LANES];
+
+  for(int k = 0; k < REDUCE_LANES; k++) lane[k] = __builtin_nan("");
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int k = 0; k < REDUCE_LANES; k++){
+      lane[k] = __math_fmin(x[i+k], lane[k]);
+    }
+  }
+  for(int k = 0; i < n; i++, k++){
+    lane[k] = __math_fmin(lane[k], x[i]);
+  }
+
+  double m = lane[0];
+  for(int k = 1; k < REDUCE_LANES; k++) m = __math_fmin(m, lane[k]);
+
+  return m;
+}
+
+#endif
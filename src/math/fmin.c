@@ -0,0 +1,34 @@
+/*
+
+  fmin.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FMIN_C
+#define MATH_FMIN_C
+
+#include "math.h"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h
+
+*/
+double fmin(double x, double y){
+  return __math_fmin(x, y);
+}
+
+float fminf(float x, float y){
+  return __math_fminf(x, y);
+}
+
+long double fminl(long double x, long double y){
+  return __math_fminl(x, y);
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*
+
+  frexp.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_FREXP_C
+#define MATH_FREXP_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+
+
+/*
+
+  Splits x into a fraction in [1/2,1) and a power of two. For normal numbers
+  that is the exponent field read out and replaced by that of 1/2. Zeros,
+  infinities and NaNs are returned as they are with *exp set to 0.
+
+*/
+double frexp(double x, int *exp){
+  return frexpCore(x, exp);
+}
+
+float frexpf(float x, int *exp){
+  return frexpCoref(x, exp);
+}
+
+long double frexpl(long double x, int *exp){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return frexp(x, exp);
+#else
+  return frexpCorel(x, exp);
+#endif
+}
+
+#endif
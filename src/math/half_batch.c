@@ -0,0 +1,146 @@
+/*
+
+  half_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HALF_BATCH_C
+#define MATH_HALF_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "math/HalfFloat.c"
+#include "math/HalfKernels.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Number of elements widened to float at once. The float block stays in L1, so
+  the 16 bit arrays are the only memory traffic.
+
+*/
+#define HALF_BLOCK 64
+
+enum halfFunction { HALF_COS, HALF_SIN, HALF_EXP, HALF_TANH };
+
+
+/*
+
+  Applies f to count (<= HALF_BLOCK) floats in place.
+
+  For cos and sin the vectorized loop only handles arguments the Cody-Waite
+  reduction can. The rest (only ever infinities and NaNs from half, but large
+  bfloat16 values too) are noted and redone afterwards, as in sincosBlock.
+
+*/
+static inline void halfBlock(float *x, size_t count, enum halfFunction f){
+  switch(f){
+    case HALF_COS:
+    case HALF_SIN: {
+      int cosine = f == HALF_COS;
+      float in[HALF_BLOCK];
+      int slow = 0;
+
+      for(size_t i = 0; i < count; i++){
+        in[i] = x[i];
+        slow |= !(__builtin_fabsf(x[i]) < TRIG_REDUCE_MEDIUM);
+        x[i] = trigHalfMedium(x[i], cosine);
+      }
+
+      if(slow){
+        for(size_t i = 0; i < count; i++){
+          if(__builtin_fabsf(in[i]) < TRIG_REDUCE_MEDIUM) continue;
+          x[i] = in[i] - in[i] != 0 ? in[i] - in[i]
+                                    : trigHalfLarge(in[i], cosine);
+        }
+      }
+      break;
+    }
+
+    case HALF_EXP:
+      for(size_t i = 0; i < count; i++){
+        x[i] = expHalfKernel(x[i]);
+      }
+      break;
+
+    case HALF_TANH:
+      for(size_t i = 0; i < count; i++){
+        x[i] = tanhHalfKernel(x[i]);
+      }
+      break;
+  }
+}
+
+
+/*
+
+  Widens a block of x to float, applies f, and narrows it back into y. bf16
+  selects bfloat16 rather than half.
+
+*/
+static inline void halfBatch(const uint16_t *x, uint16_t *y, size_t n,
+                             enum halfFunction f, int bf16){
+  float block[HALF_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += HALF_BLOCK){
+    size_t count = n-i < HALF_BLOCK ? n-i : HALF_BLOCK;
+
+    if(bf16){
+      bf16ToFloatArray(x+i, block, count);
+    }else{
+      halfToFloatArray(x+i, block, count);
+    }
+
+    halfBlock(block, count, f);
+
+    if(bf16){
+      floatToBf16Array(block, y+i, count);
+    }else{
+      floatToHalfArray(block, y+i, count);
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+void cos_f16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_COS, 0);
+}
+
+void sin_f16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_SIN, 0);
+}
+
+void exp_f16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_EXP, 0);
+}
+
+void tanh_f16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_TANH, 0);
+}
+
+void cos_bf16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_COS, 1);
+}
+
+void sin_bf16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_SIN, 1);
+}
+
+void exp_bf16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_EXP, 1);
+}
+
+void tanh_bf16_batch(const uint16_t *x, uint16_t *y, size_t n){
+  halfBatch(x, y, n, HALF_TANH, 1);
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+
+  hypot.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_HYPOT_C
+#define MATH_HYPOT_C
+
+#include "math.h"
+#include "math/MathErrno.c"
+#include "math/HypotKernel.c"
+
+
+/*
+
+  Returns sqrt(x^2 + y^2), without overflow or underflow in between.
+
+  An infinite argument makes the result infinite, even if the other is a NaN.
+  A range error occurs if the result overflows.
+
+*/
+double hypot(double x, double y){
+  if(__builtin_isinf(x) || __builtin_isinf(y)) return HUGE_VAL;
+  if(x != x || y != y) return x + y;
+
+  double r = hypotKernel(x, y);
+  if(r == HUGE_VAL) SET_ERRNO(ERANGE);
+  return r;
+}
+
+#endif
@@ -0,0 +1,52 @@
+/*
+
+  ilogb.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_ILOGB_C
+#define MATH_ILOGB_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Returns the unbiased exponent of x, counting subnormals as if they were
+  normalized. Zero, infinity and NaN have none, and are domain errors.
+
+*/
+int ilogb(double x){
+  if(doubleIsNormal(x)) return (int)doubleExponent(x) - 0x3ff;
+
+  int e = ilogbSlow(x);
+  if(x == 0 || x - x != 0) SET_ERRNO(EDOM);
+  return e;
+}
+
+int ilogbf(float x){
+  if(floatIsNormal(x)) return (int)floatExponent(x) - 0x7f;
+
+  int e = ilogbSlowf(x);
+  if(x == 0 || x - x != 0) SET_ERRNO(EDOM);
+  return e;
+}
+
+int ilogbl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return ilogb(x);
+#else
+  int e = ilogbCorel(x);
+  if(x == 0 || x - x != 0) SET_ERRNO(EDOM);
+  return e;
+#endif
+}
+
+#endif
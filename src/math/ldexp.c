@@ -0,0 +1,55 @@
+/*
+
+  ldexp.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LDEXP_C
+#define MATH_LDEXP_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Computes x*2^exp. With binary floating point ldexp and scalbn are the same
+  function, so this is scalbn again on the same helpers, range errors
+  included.
+
+*/
+double ldexp(double x, int exp){
+  if(doubleIsNormal(x) && scaleStaysNormal(x, exp)) return scaleNormal(x, exp);
+
+  double y = scalbnSlow(x, exp);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+}
+
+float ldexpf(float x, int exp){
+  if(floatIsNormal(x) && scaleStaysNormalf(x, exp)){
+    return scaleNormalf(x, exp);
+  }
+
+  float y = scalbnSlowf(x, exp);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+}
+
+long double ldexpl(long double x, int exp){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return ldexp(x, exp);
+#else
+  long double y = scalbnCorel(x, exp);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+#endif
+}
+
+#endif
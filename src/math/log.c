@@ -0,0 +1,73 @@
+/*
+
+  log.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LOG_C
+#define MATH_LOG_C
+
+#include "math.h"
+#include <float.h>
+#include "math/MathErrno.c"
+#include "math/LogKernel.c"
+
+
+/*
+
+  Returns the natural logarithm of x.
+
+  Negative x is a domain error (NaN), zero a pole error (-inf). Subnormals are
+  scaled up by 2^54 to be split like any normal number.
+
+*/
+__MATH_NOCLONE double log(double x){
+  double f, k;
+
+  if(!(x >= DBL_MIN && x <= DBL_MAX)){
+    if(x != x || x == HUGE_VAL) return x + x;
+    if(x == 0){
+      SET_ERRNO(ERANGE);
+      return -1/__builtin_fabs(x);
+    }
+    if(x < 0){
+      SET_ERRNO(EDOM);
+      return (x - x)/(x - x);
+    }
+
+    k = logReduce(x*0x1p54, &f) - 54;
+    return logKernel(k, f, 0);
+  }
+
+  k = logReduce(x, &f);
+  return logKernel(k, f, 0);
+}
+
+
+/*
+
+  float version of log, in double precision and rounded once. Every positive
+  float, subnormals included, is a normal double, so none need scaling.
+
+*/
+float logf(float x){
+  if(!(x > 0 && x <= FLT_MAX)){
+    if(x != x || x == HUGE_VALF) return x + x;
+    if(x == 0){
+      SET_ERRNO(ERANGE);
+      return -1/__builtin_fabsf(x);
+    }
+    SET_ERRNO(EDOM);
+    return (x - x)/(x - x);
+  }
+
+  double f;
+  double k = logReduce(x, &f);
+  return (float)logKernel(k, f, 0);
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+
+  logb.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LOGB_C
+#define MATH_LOGB_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Returns the unbiased exponent of x as a floating-point number, counting
+  subnormals as if they were normalized. logb of zero is -infinity, and a pole
+  error.
+
+*/
+double logb(double x){
+  if(doubleIsNormal(x)) return (int)doubleExponent(x) - 0x3ff;
+
+  if(x == 0) SET_ERRNO(ERANGE);
+  return logbSlow(x);
+}
+
+float logbf(float x){
+  if(floatIsNormal(x)) return (int)floatExponent(x) - 0x7f;
+
+  if(x == 0) SET_ERRNO(ERANGE);
+  return logbSlowf(x);
+}
+
+long double logbl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return logb(x);
+#else
+  if(longDoubleIsNormal(x)) return (int)longDoubleExponent(x) - 0x3fff;
+
+  if(x == 0){
+    SET_ERRNO(ERANGE);
+    return -1/__builtin_fabsl(x);
+  }
+  if(x - x != 0) return x*x;
+  return ilogbSlowl(x);
+#endif
+}
+
+#endif
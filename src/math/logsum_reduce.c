@@ -0,0 +1,103 @@
+/*
+
+  logsum_reduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LOGSUM_REDUCE_C
+#define MATH_LOGSUM_REDUCE_C
+
+#include "math.h"
+#include <float.h>
+#include <stddef.h>
+#include "math/DoubleDouble.c"
+#include "math/FloatBits.c"
+#include "math/FlushSubnormals.c"
+#include "math/LogKernel.c"
+#include "math/Reduce.c"
+
+
+/*
+
+  Returns log(1+f) for x = 2^k*(1+f), storing k, for positive finite x
+  (subnormals are scaled up as in log). Anything else is replaced by 1, so it
+  adds nothing, and noted in *special.
+
+*/
+static inline double logTerm(double x, double *k, uint64_t *special){
+  uint64_t ok = __builtin_isgreater(x, 0) & __builtin_isless(x, HUGE_VAL);
+  uint64_t subnormal = __builtin_isless(x, DBL_MIN);
+  *special |= ok ^ 1;
+
+  double f;
+  double xs = selectDouble(ok, selectDouble(subnormal, x*0x1p54, x), 1);
+  *k = logReduce(xs, &f) - selectDouble(ok & subnormal, 54, 0);
+  return logKernel(0, f, 0);
+}
+
+
+/*
+
+  Returns log(x[0]) + ... + log(x[n-1]), the log of the product of the
+  elements, which doesn't overflow where the product would.
+
+  Each logarithm is computed and added in the same pass, without an array in
+  between. The log(1+f) of each element goes into the compensated sums of
+  Reduce.c, and the k of each into a sum of its own, which is exact, so that
+  k*log(2) is multiplied out once at the end instead of rounded per element.
+
+  Zeros, negative numbers, infinities and NaNs are left out of that pass and
+  added afterwards in a second one, as their logarithms: -inf, NaN, inf and
+  NaN. So any zero makes the result -inf and any negative number or NaN makes
+  it NaN, as the logarithm of the product would be. No errno is set.
+
+*/
+double logsum_reduce(const double *x, size_t n){
+  double s[REDUCE_LANES], c[REDUCE_LANES], k[REDUCE_LANES];
+  uint64_t special = 0;
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(int j = 0; j < REDUCE_LANES; j++) s[j] = c[j] = k[j] = 0;
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int j = 0; j < REDUCE_LANES; j++){
+      double kj;
+      double m = logTerm(x[i+j], &kj, &special);
+      reduceAdd(&s[j], &c[j], m, 0);
+      k[j] += kj;
+    }
+  }
+  for(int j = 0; i < n; i++, j++){
+    double kj;
+    double m = logTerm(x[i], &kj, &special);
+    reduceAdd(&s[j], &c[j], m, 0);
+    k[j] += kj;
+  }
+
+  // sum(k)*log(2), with the rounding of the product kept
+  double kt = 0;
+  for(int j = 0; j < REDUCE_LANES; j++) kt += k[j];
+  double hi = kt*LOG_LN2_HI;
+  reduceAdd(&s[0], &c[0], hi, mulError(kt, LOG_LN2_HI, hi) + kt*LOG_LN2_LO);
+
+  double r = reduceLanes(s, c);
+
+  if(special){
+    for(i = 0; i < n; i++){
+      double v = x[i];
+      if(__builtin_isgreater(v, 0) && __builtin_isless(v, HUGE_VAL)) continue;
+      r += v == 0 ? -HUGE_VAL : v < 0 ? __builtin_nan("") : v;
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+  return r;
+}
+
+#endif
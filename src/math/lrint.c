@@ -0,0 +1,102 @@
+/*
+
+  lrint.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LRINT_C
+#define MATH_LRINT_C
+
+#include "math.h"
+#include <float.h>
+#include <limits.h>
+#include "math/FloatToInt.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Rounds x to an integer in the current rounding direction.
+
+  Arguments within range are a single conversion instruction on x86-64. A
+  result outside the range of long (or a NaN argument) is a domain error,
+  which raises the invalid exception and returns LONG_MIN, the same value
+  the instruction gives.
+
+*/
+long lrint(double x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE){
+    int64_t r = rintToInt64(x);
+    if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  }
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+}
+
+long lrintf(float x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE){
+    int64_t r = rintfToInt64(x);
+    if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  }
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+}
+
+long long llrint(double x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE) return rintToInt64(x);
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+}
+
+long long llrintf(float x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE) return rintfToInt64(x);
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+}
+
+
+/*
+
+  long double versions. Adding and subtracting 2^(LDBL_MANT_DIG-1) rounds in
+  the current direction, after which the conversion is exact. The range is
+  checked on the rounded value, since anything in (2^63-1,2^63) can round up
+  to 2^63.
+
+*/
+long long llrintl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return llrint(x);
+#else
+  long double r = x;
+  if(__builtin_fabsl(x) < 1/LDBL_EPSILON){
+    long double magic = __builtin_copysignl(1/LDBL_EPSILON, x);
+    r = (x + magic) - magic;
+  }
+  if(r >= -INT64_RANGE && r < INT64_RANGE) return (int64_t)r;
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+#endif
+}
+
+long lrintl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return lrint(x);
+#else
+  long long r = llrintl(x);
+  if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+#endif
+}
+
+#endif
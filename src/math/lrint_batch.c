@@ -0,0 +1,124 @@
+/*
+
+  lrint_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LRINT_BATCH_C
+#define MATH_LRINT_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "math/FloatToInt.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Number of elements worked on at once by the 64 bit conversions, as in
+  sincos_batch
+
+*/
+#define LRINT_BLOCK 64
+
+
+/*
+
+  Compute y[i] = x[i] rounded to an integer in the current rounding
+  direction, saturated to the range of y's type, with NaN converted to 0, for
+  i in [0,n).
+
+  Narrower types are clamped before rounding, and rintSaturate's loops
+  vectorize as they are. int64_t can't be clamped in double precision below
+  2^51 as rintSaturate needs, so those loops handle only arguments up to
+  that, noting larger ones (and NaNs) to be redone afterwards, as in
+  sincosBlock.
+
+*/
+void lrint_i16_batch(const double *x, int16_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = (int16_t)rintSaturate(x[i], INT16_MIN, INT16_MAX);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void lrint_i32_batch(const double *x, int32_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = (int32_t)rintSaturate(x[i], INT32_MIN, INT32_MAX);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void lrintf_i16_batch(const float *x, int16_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = (int16_t)rintSaturatef(x[i], INT16_MIN, INT16_MAX);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void lrintf_i32_batch(const float *x, int32_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = (int32_t)rintSaturate(x[i], INT32_MIN, INT32_MAX);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+
+static inline void lrintBlock(const double *x, int64_t *y, size_t count){
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    slow |= !(__builtin_fabs(x[i]) < 0x1p51);
+    y[i] = rintSaturate(x[i], -0x1p51, 0x1p51);
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(!(__builtin_fabs(x[i]) < 0x1p51)) y[i] = rintSaturate64(x[i]);
+    }
+  }
+}
+
+static inline void lrintfBlock(const float *x, int64_t *y, size_t count){
+  int slow = 0;
+
+  for(size_t i = 0; i < count; i++){
+    slow |= !(__builtin_fabsf(x[i]) < 0x1p51f);
+    y[i] = rintSaturate(x[i], -0x1p51, 0x1p51);
+  }
+
+  if(slow){
+    for(size_t i = 0; i < count; i++){
+      if(!(__builtin_fabsf(x[i]) < 0x1p51f)) y[i] = rintSaturate64(x[i]);
+    }
+  }
+}
+
+void lrint_i64_batch(const double *x, int64_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i += LRINT_BLOCK){
+    size_t count = n-i < LRINT_BLOCK ? n-i : LRINT_BLOCK;
+    lrintBlock(x+i, y+i, count);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void lrintf_i64_batch(const float *x, int64_t *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i += LRINT_BLOCK){
+    size_t count = n-i < LRINT_BLOCK ? n-i : LRINT_BLOCK;
+    lrintfBlock(x+i, y+i, count);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+#endif
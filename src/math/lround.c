@@ -0,0 +1,100 @@
+/*
+
+  lround.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_LROUND_C
+#define MATH_LROUND_C
+
+#include "math.h"
+#include <float.h>
+#include <limits.h>
+#include "math/FloatToInt.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Rounds x to the nearest integer, halfway cases away from zero. A result
+  outside the range of long (or a NaN argument) is a domain error, as for
+  lrint.
+
+*/
+long lround(double x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE){
+    int64_t r = roundToInt64(x);
+    if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  }
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+}
+
+long lroundf(float x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE){
+    int64_t r = roundfToInt64(x);
+    if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  }
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+}
+
+long long llround(double x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE) return roundToInt64(x);
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+}
+
+long long llroundf(float x){
+  if(x >= -INT64_RANGE && x < INT64_RANGE) return roundfToInt64(x);
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+}
+
+long long llroundl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return llround(x);
+#else
+  /*
+    Truncating is exact for anything in (-2^63-1,2^63), and it's only the step
+    away from t that can leave the range of int64_t, so that is checked
+    before it is taken. (-0x1p63L-1 is exact in every long double format.)
+  */
+  if(x > -INT64_RANGE-1.0L && x < INT64_RANGE){
+    int64_t t = (int64_t)x;
+    long double d = x - t;
+    if(d >= 0.5L){
+      if(t < INT64_MAX) return t + 1;
+    }else if(d <= -0.5L){
+      if(t > INT64_MIN) return t - 1;
+    }else{
+      return t;
+    }
+  }
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LLONG_MIN;
+#endif
+}
+
+long lroundl(long double x){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return lround(x);
+#else
+  long long r = llroundl(x);
+  if(r >= LONG_MIN && r <= LONG_MAX) return r;
+  raiseInvalid();
+  SET_ERRNO(EDOM);
+  return LONG_MIN;
+#endif
+}
+
+#endif
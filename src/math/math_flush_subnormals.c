@@ -0,0 +1,28 @@
+/*
+
+  math_flush_subnormals.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#include "math.h"
+#include "math/FlushSubnormals.c"
+
+
+_Thread_local int mathFlushSubnormals;
+
+
+/*
+
+  Turns flushing of subnormals in the batch functions on or off for the calling
+  thread, and returns the previous setting so that it can be restored.
+
+*/
+int math_flush_subnormals(int enable){
+  int previous = mathFlushSubnormals;
+  mathFlushSubnormals = enable != 0;
+  return previous;
+}
@@ -0,0 +1,159 @@
+/*
+
+  math_stats.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#include "mathstats.h"
+#include <string.h>
+
+
+static const char *const FUNCTION_NAMES[MATH_STATS_FUNCTIONS] = {
+  "cos", "sin", "tan", "sincos", "sincos_batch"
+};
+
+static const char *const PATH_NAMES[MATH_STATS_PATHS] = {
+  "small", "medium", "large", "special", "tiny"
+};
+
+
+#ifdef MATH_STATS
+
+#include <stdlib.h>
+#include "math/MathStats.c"
+
+
+_Thread_local struct mathStatsThread *mathStatsLocal;
+
+// Every thread's counters, newest first. Blocks are never freed, so the
+// counts of threads that have exited still show up in snapshots.
+static struct mathStatsThread *mathStatsThreads;
+
+
+/*
+
+  Gives the calling thread its own zeroed, cache line aligned block of counters
+  and adds it to the list. Only runs on a thread's first counted call.
+
+*/
+struct mathStatsThread *mathStatsRegister(void){
+  struct mathStatsThread *t = aligned_alloc(64, sizeof(*t));
+  if(!t) abort();
+  memset(t, 0, sizeof(*t));
+
+  t->next = __atomic_load_n(&mathStatsThreads, __ATOMIC_RELAXED);
+  while(!__atomic_compare_exchange_n(&mathStatsThreads, &t->next, t, 1,
+                                     __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+  mathStatsLocal = t;
+  return t;
+}
+
+#endif
+
+
+/*
+
+  Adds up the counters of every thread into *out
+
+*/
+void math_stats_snapshot(struct math_stats *out){
+  memset(out, 0, sizeof(*out));
+
+#ifdef MATH_STATS
+  struct mathStatsThread *t = __atomic_load_n(&mathStatsThreads, __ATOMIC_ACQUIRE);
+  for(; t; t = t->next){
+    for(int f = 0; f < MATH_STATS_FUNCTIONS; f++){
+      const struct math_stats_counters *from = &t->stats.function[f];
+      struct math_stats_counters *to = &out->function[f];
+
+      to->calls += __atomic_load_n(&from->calls, __ATOMIC_RELAXED);
+      for(int p = 0; p < MATH_STATS_PATHS; p++){
+        to->path[p] += __atomic_load_n(&from->path[p], __ATOMIC_RELAXED);
+      }
+      for(int b = 0; b < MATH_STATS_BUCKETS; b++){
+        to->magnitude[b] += __atomic_load_n(&from->magnitude[b], __ATOMIC_RELAXED);
+      }
+    }
+  }
+#endif
+}
+
+
+/*
+
+  Zeroes every thread's counters. Increments racing with the reset may survive
+  it or be lost.
+
+*/
+void math_stats_reset(void){
+#ifdef MATH_STATS
+  struct mathStatsThread *t = __atomic_load_n(&mathStatsThreads, __ATOMIC_ACQUIRE);
+  for(; t; t = t->next){
+    uint64_t *c = (uint64_t *)&t->stats;
+    for(size_t i = 0; i < sizeof(t->stats)/sizeof(uint64_t); i++){
+      __atomic_store_n(&c[i], 0, __ATOMIC_RELAXED);
+    }
+  }
+#endif
+}
+
+
+const char *math_stats_function_name(enum math_stats_function f){
+  return (unsigned)f < MATH_STATS_FUNCTIONS ? FUNCTION_NAMES[f] : "?";
+}
+
+const char *math_stats_path_name(enum math_stats_path p){
+  return (unsigned)p < MATH_STATS_PATHS ? PATH_NAMES[p] : "?";
+}
+
+
+/*
+
+  Writes a bucket's range in the same form as the documentation in mathstats.h
+
+*/
+static void dumpBucket(FILE *out, int b){
+  switch(b){
+    case MATH_STATS_BUCKET_ZERO: fprintf(out, "zero"); break;
+    case MATH_STATS_BUCKET_SUBNORMAL: fprintf(out, "subnormal"); break;
+    case MATH_STATS_BUCKET_TINY: fprintf(out, "< 2^%d", MATH_STATS_MIN_EXP); break;
+    case MATH_STATS_BUCKET_HUGE: fprintf(out, ">= 2^%d", MATH_STATS_MAX_EXP+1); break;
+    case MATH_STATS_BUCKET_NONFINITE: fprintf(out, "inf/nan"); break;
+    default: {
+      int e = b - MATH_STATS_BUCKET_EXP(0);
+      fprintf(out, "[2^%d,2^%d)", e, e+1);
+    }
+  }
+}
+
+
+void math_stats_dump(FILE *out){
+  struct math_stats s;
+  math_stats_snapshot(&s);
+
+  for(int f = 0; f < MATH_STATS_FUNCTIONS; f++){
+    const struct math_stats_counters *c = &s.function[f];
+    if(!c->calls) continue;
+
+    fprintf(out, "%s: %llu calls\n", FUNCTION_NAMES[f],
+            (unsigned long long)c->calls);
+
+    for(int p = 0; p < MATH_STATS_PATHS; p++){
+      if(!c->path[p]) continue;
+      fprintf(out, "  path %-8s %llu\n", PATH_NAMES[p],
+              (unsigned long long)c->path[p]);
+    }
+
+    for(int b = 0; b < MATH_STATS_BUCKETS; b++){
+      if(!c->magnitude[b]) continue;
+      fprintf(out, "  |x| ");
+      dumpBucket(out, b);
+      fprintf(out, " %llu\n", (unsigned long long)c->magnitude[b]);
+    }
+  }
+}
@@ -0,0 +1,45 @@
+/*
+
+  modf.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_MODF_C
+#define MATH_MODF_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+
+
+/*
+
+  Splits x into its integral part, stored in *ip, and its fractional part,
+  which is returned. Both have the sign of x. Infinities have a fractional
+  part of zero, and NaN is returned in both.
+
+*/
+double modf(double x, double *ip){
+  return modfCore(x, ip);
+}
+
+float modff(float x, float *ip){
+  return modfCoref(x, ip);
+}
+
+long double modfl(long double x, long double *ip){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  double i;
+  double f = modf(x, &i);
+  *ip = i;
+  return f;
+#else
+  return modfCorel(x, ip);
+#endif
+}
+
+#endif
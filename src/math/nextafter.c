@@ -0,0 +1,92 @@
+/*
+
+  nextafter.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_NEXTAFTER_C
+#define MATH_NEXTAFTER_C
+
+#include "math.h"
+#include <float.h>
+#include "math/Exponent.c"
+
+
+/*
+
+  Out-of-line copies of the inline definitions in math.h
+
+*/
+double nextafter(double x, double y){
+  return __math_nextafter(x, y);
+}
+
+float nextafterf(float x, float y){
+  return __math_nextafterf(x, y);
+}
+
+double nexttoward(double x, long double y){
+  return __math_nexttoward(x, y);
+}
+
+float nexttowardf(float x, long double y){
+  return __math_nexttowardf(x, y);
+}
+
+
+/*
+
+  long double version of nextafter, stepping the significand up or down by
+  one like roundToOddl in fma.c. In the x87 format the leading bit is
+  explicit, so the exponent field has to be carried by hand between binades,
+  and between the subnormals (exponent field 0) and the normals.
+
+*/
+long double nextafterl(long double x, long double y){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return nextafter(x, y);
+#else
+  if(x != x || y != y) return x + y;
+  if(x == y) return y;
+  if(x == 0) return __builtin_copysignl(LDBL_TRUE_MIN, y);
+
+  union longDoubleBits u = { x };
+  int away = (x < y) != (__builtin_signbit(x) != 0);
+
+#if LDBL_MANT_DIG == 64
+  if(away){
+    if(++u.i.m == 0){
+      u.i.m = 1ull<<63;
+      u.i.se++;
+    }else if(u.i.m == 1ull<<63 && (u.i.se & 0x7fff) == 0){
+      u.i.se++;
+    }
+  }else{
+    if(u.i.m == 1ull<<63 && (u.i.se & 0x7fff) != 0){
+      u.i.se--;
+      u.i.m = (u.i.se & 0x7fff) ? ~0ull : (1ull<<63) - 1;
+    }else{
+      u.i.m--;
+    }
+  }
+#else
+  if(away){
+    u.i.hi += (++u.i.lo == 0);
+  }else{
+    u.i.hi -= (u.i.lo-- == 0);
+  }
+#endif
+
+  return u.f;
+#endif
+}
+
+long double nexttowardl(long double x, long double y){
+  return nextafterl(x, y);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+
+  scalbn.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SCALBN_C
+#define MATH_SCALBN_C
+
+#include "math.h"
+#include <float.h>
+#include <limits.h>
+#include "math/Exponent.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Computes x*2^n.
+
+  When both x and the result are normal numbers this is n added to the
+  exponent field. Anything else goes through scalbnSlow, and overflowing to
+  infinity or underflowing to zero from a finite, nonzero x is a range error.
+
+*/
+double scalbn(double x, int n){
+  if(doubleIsNormal(x) && scaleStaysNormal(x, n)) return scaleNormal(x, n);
+
+  double y = scalbnSlow(x, n);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+}
+
+float scalbnf(float x, int n){
+  if(floatIsNormal(x) && scaleStaysNormalf(x, n)) return scaleNormalf(x, n);
+
+  float y = scalbnSlowf(x, n);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+}
+
+long double scalbnl(long double x, int n){
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+  return scalbn(x, n);
+#else
+  long double y = scalbnCorel(x, n);
+  if((y == 0 || y - y != 0) && x != 0 && x - x == 0) SET_ERRNO(ERANGE);
+  return y;
+#endif
+}
+
+
+/*
+
+  scalbn with a long exponent. Any n beyond the range of int already takes
+  every finite, nonzero x to infinity or zero, so it is clamped to that range.
+
+*/
+static inline int clampScale(long n){
+  return n > INT_MAX ? INT_MAX : n < INT_MIN ? INT_MIN : (int)n;
+}
+
+double scalbln(double x, long n){
+  return scalbn(x, clampScale(n));
+}
+
+float scalblnf(float x, long n){
+  return scalbnf(x, clampScale(n));
+}
+
+long double scalblnl(long double x, long n){
+  return scalbnl(x, clampScale(n));
+}
+
+#endif
@@ -8,8 +8,15 @@
 
 */
 
+#ifndef MATH_SIN_C
+#define MATH_SIN_C
+
 #include "math.h"
-#include "math/cos.c"
+#include "math/TrigReduce.c"
+#include "math/MathErrno.c"
+#include "math/SinKernel.c"
+#include "math/CosKernel.c"
+#include "math/FloatTrigKernel.c"
 
 
 /*
@@ -20,7 +27,52 @@
   https://github.com/lougehrig10/C-Standard-Library/wiki/sin_
 
 */
-double sin(double x){
+__MATH_NOCLONE double sin(double x){
+  MATH_STATS_CALL(MATH_STATS_SIN, x);
+
+  if(__builtin_fabs(x) < TRIG_TINY){
+    MATH_STATS_PATH(MATH_STATS_SIN, MATH_STATS_PATH_TINY);
+    return x;
+  }
+
+  // Close enough to zero that no reduction is needed
+  if(__builtin_fabs(x) <= PIO4){
+    MATH_STATS_PATH(MATH_STATS_SIN, MATH_STATS_PATH_SMALL);
+    return sinKernel(x, 0);
+  }
+
+  // sin of infinity or NaN is NaN, and infinity is a domain error
+  if(x - x != 0){
+    MATH_STATS_PATH(MATH_STATS_SIN, MATH_STATS_PATH_SPECIAL);
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+  MATH_STATS_PATH(MATH_STATS_SIN, TRIG_REDUCE_PATH(x));
+
   // sin is cos shifted right a quarter of a circle
-  return cos(x-M_PI/2);
+  double y0, y1;
+  switch(trigReduce(x, &y0, &y1)){
+    case 0: return sinKernel(y0, y1);
+    case 1: return cosKernel(y0, y1);
+    case 2: return -sinKernel(y0, y1);
+    default: return -cosKernel(y0, y1);
+  }
+}
+
+
+
+/*
+
+  float version of sin, evaluated in double precision with the shorter kernels
+  of FloatTrigKernel.c and rounded once at the end
+
+*/
+__MATH_NOCLONE float sinf(float x){
+  if(x - x != 0){
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+  return (float)trigFloat(x, 0);
 }
+
+#endif
@@ -0,0 +1,44 @@
+/*
+
+  sin_q.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SIN_Q_C
+#define MATH_SIN_Q_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/QuarterWave.c"
+
+
+/*
+
+  Sine of an angle given as a binary fraction of a full turn, for fixed-point
+  code that would otherwise convert to radians just to call sin.
+
+  sin_q32 takes a 32 bit angle (2^32 is a full turn) and returns Q1.31.
+  sin_q16 takes a 16 bit angle (2^16 is a full turn) and returns Q1.15.
+  sinf_q32 takes a 32 bit angle and returns a float.
+
+  In Q1.31 and Q1.15 the value 1.0 can't be represented, so it saturates to
+  the largest one that can. -1.0 can, and is INT32_MIN or INT16_MIN.
+
+*/
+int32_t sin_q32(uint32_t turns){
+  return quarterWaveSinQ31(turns);
+}
+
+int16_t sin_q16(uint16_t turns){
+  return quarterWaveSinQ15(turns);
+}
+
+float sinf_q32(uint32_t turns){
+  return quarterWaveSinQ31(turns) * 0x1p-31f;
+}
+
+#endif
@@ -0,0 +1,62 @@
+/*
+
+  sin_q_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SIN_Q_BATCH_C
+#define MATH_SIN_Q_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "math/QuarterWave.c"
+
+
+/*
+
+  Array forms of sin_q32, sin_q16, sinf_q32 and their cos counterparts, each
+  computing y[i] from turns[i] for i in [0,n)
+
+*/
+void sin_q32_batch(const uint32_t *turns, int32_t *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ31(turns[i]);
+  }
+}
+
+void cos_q32_batch(const uint32_t *turns, int32_t *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ31(turns[i] + 0x40000000u);
+  }
+}
+
+void sin_q16_batch(const uint16_t *turns, int16_t *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ15(turns[i]);
+  }
+}
+
+void cos_q16_batch(const uint16_t *turns, int16_t *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ15((uint16_t)(turns[i] + 0x4000u));
+  }
+}
+
+void sinf_q32_batch(const uint32_t *turns, float *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ31(turns[i]) * 0x1p-31f;
+  }
+}
+
+void cosf_q32_batch(const uint32_t *turns, float *y, size_t n){
+  for(size_t i = 0; i < n; i++){
+    y[i] = quarterWaveSinQ31(turns[i] + 0x40000000u) * 0x1p-31f;
+  }
+}
+
+#endif
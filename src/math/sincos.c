@@ -0,0 +1,52 @@
+/*
+
+  sincos.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINCOS_C
+#define MATH_SINCOS_C
+
+#include "math.h"
+#include "math/TrigReduce.c"
+#include "math/MathErrno.c"
+#include "math/SincosKernel.c"
+
+
+/*
+
+  Computes both the sine and cosine of x (measured in radians).
+
+  Calling sin and cos separately reduces the argument twice. Here it is reduced
+  once and both kernels run on the result.
+
+*/
+void sincos(double x, double *sinx, double *cosx){
+  MATH_STATS_CALL(MATH_STATS_SINCOS, x);
+
+  if(__builtin_fabs(x) < TRIG_TINY){
+    MATH_STATS_PATH(MATH_STATS_SINCOS, MATH_STATS_PATH_TINY);
+    *sinx = x;
+    *cosx = 1.0;
+    return;
+  }
+
+  // sin and cos of infinity or NaN are NaN, and infinity is a domain error
+  if(x - x != 0){
+    MATH_STATS_PATH(MATH_STATS_SINCOS, MATH_STATS_PATH_SPECIAL);
+    if(x == x) SET_ERRNO(EDOM);
+    *sinx = *cosx = x - x;
+    return;
+  }
+
+  MATH_STATS_PATH(MATH_STATS_SINCOS, TRIG_REDUCE_PATH(x));
+  double y0, y1;
+  int n = trigReduce(x, &y0, &y1);
+  sincosQuadrant(n, y0, y1, sinx, cosx);
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+
+  sincos_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINCOS_BATCH_C
+#define MATH_SINCOS_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/SincosBlock.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Computes sinx[i] = sin(x[i]) and cosx[i] = cos(x[i]) for n contiguous
+  arguments
+
+*/
+void sincos_batch(const double *x, double *sinx, double *cosx, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+    sincosBlock(x+i, sinx+i, cosx+i, count);
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+/*
+
+  Same as sincos_batch, but element i of each array is found stride elements
+  after element i-1. Strides may be negative or zero.
+
+  Each block of arguments is gathered into a small contiguous buffer, run
+  through the same vectorized block as sincos_batch, and the results scattered
+  back out, so callers don't have to copy whole arrays around themselves.
+
+*/
+void sincos_strided(const double *x, ptrdiff_t xstride,
+                    double *sinx, ptrdiff_t sstride,
+                    double *cosx, ptrdiff_t cstride, size_t n){
+  double xs[SINCOS_BLOCK], ss[SINCOS_BLOCK], cs[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+
+    for(size_t j = 0; j < count; j++){
+      xs[j] = x[(ptrdiff_t)(i+j)*xstride];
+    }
+
+    sincosBlock(xs, ss, cs, count);
+
+    for(size_t j = 0; j < count; j++){
+      sinx[(ptrdiff_t)(i+j)*sstride] = ss[j];
+      cosx[(ptrdiff_t)(i+j)*cstride] = cs[j];
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+
+/*
+
+  Computes cos and sin of n arguments found xstride elements apart, and writes
+  them as interleaved (cos, sin) pairs: cossin[2i] = cos(x[i]) and
+  cossin[2i+1] = sin(x[i]). That is the layout of an array of double complex,
+  so this fills it with e^(i*x) directly.
+
+*/
+void sincos_interleaved(const double *x, ptrdiff_t xstride, double *cossin,
+                        size_t n){
+  double xs[SINCOS_BLOCK], ss[SINCOS_BLOCK], cs[SINCOS_BLOCK];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(size_t i = 0; i < n; i += SINCOS_BLOCK){
+    size_t count = n-i < SINCOS_BLOCK ? n-i : SINCOS_BLOCK;
+
+    for(size_t j = 0; j < count; j++){
+      xs[j] = x[(ptrdiff_t)(i+j)*xstride];
+    }
+
+    sincosBlock(xs, ss, cs, count);
+
+    double *out = cossin + 2*i;
+    for(size_t j = 0; j < count; j++){
+      out[2*j] = cs[j];
+      out[2*j+1] = ss[j];
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+
+  sincos_sequence.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINCOS_SEQUENCE_C
+#define MATH_SINCOS_SEQUENCE_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/MulAdd.c"
+#include "math/SincosBlock.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  The sequence is generated as SEQUENCE_LANES interleaved sub-sequences, each
+  stepping by SEQUENCE_LANES*dx, so that the lanes are independent of one
+  another and fill a vector register. Every SEQUENCE_STEPS steps all lanes are
+  seeded again from sincos, which bounds how far rounding errors can build up.
+
+*/
+#define SEQUENCE_LANES 4
+#define SEQUENCE_STEPS 16
+#define SEQUENCE_BLOCK (SEQUENCE_LANES*SEQUENCE_STEPS)
+
+
+/*
+
+  Computes s[i] = sin(x0 + i*dx) and c[i] = cos(x0 + i*dx) for i in [0,n).
+
+  Going from angle a to a+d is a rotation:
+
+    sin(a+d) = sin(a)*cos(d) + cos(a)*sin(d)
+    cos(a+d) = cos(a)*cos(d) - sin(a)*sin(d)
+
+  so once sin(d) and cos(d) are known each new element is a few multiply-adds,
+  instead of a full range reduction and two polynomials. Every rotation adds
+  up to half a unit in the last place of error, so the starting points are
+  recomputed with sincos every SEQUENCE_STEPS rotations. That keeps the results
+  within about SEQUENCE_STEPS/2 units in the last place of sin and cos of the
+  exact angles, for a fraction of the cost of calling sincos on every one.
+
+*/
+void sincos_sequence(double x0, double dx, size_t n, double *s, double *c){
+  double angle[SEQUENCE_LANES], ls[SEQUENCE_LANES], lc[SEQUENCE_LANES];
+  uint64_t flush = flushSubnormalsBegin();
+
+  /*
+    Rotation by one step of a lane (multiplying dx by a power of two is exact).
+    cos(d) is kept as cos(d)-1 = -2*sin(d/2)^2, since cos(d) itself is so close
+    to 1 for small steps that its rounding error would be added on every step.
+  */
+  double step[2] = {SEQUENCE_LANES*dx, SEQUENCE_LANES*dx*0.5}, ss[2], cs[2];
+  sincosBlock(step, ss, cs, 2);
+  double ds = ss[0], half = ss[1];
+  double dcm1 = -2*half*half;
+
+  for(size_t i = 0; i < n; i += SEQUENCE_BLOCK){
+    size_t count = n-i < SEQUENCE_BLOCK ? n-i : SEQUENCE_BLOCK;
+
+    // Seed each lane from its exact starting angle
+    for(int k = 0; k < SEQUENCE_LANES; k++){
+      angle[k] = MULADD((double)(i+k), dx, x0);
+    }
+
+    // 0*dx + -0 is +0, which would lose the sign of sin(-0)
+    if(i == 0) angle[0] = x0;
+    sincosBlock(angle, ls, lc, SEQUENCE_LANES);
+
+    size_t j = 0;
+    for(; j + SEQUENCE_LANES <= count; j += SEQUENCE_LANES){
+      for(int k = 0; k < SEQUENCE_LANES; k++){
+        s[i+j+k] = ls[k];
+        c[i+j+k] = lc[k];
+
+        double ns = ls[k] + MULADD(ls[k], dcm1, lc[k]*ds);
+        double nc = lc[k] + MULADD(lc[k], dcm1, -ls[k]*ds);
+        ls[k] = ns;
+        lc[k] = nc;
+      }
+    }
+
+    // What is left of the last block is fewer than one step of every lane
+    for(int k = 0; j < count; j++, k++){
+      s[i+j] = ls[k];
+      c[i+j] = lc[k];
+    }
+  }
+
+  flushSubnormalsEnd(flush);
+}
+
+#endif
@@ -0,0 +1,48 @@
+/*
+
+  sinpi.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINPI_C
+#define MATH_SINPI_C
+
+#include "math.h"
+#include "math/HalfTurnKernel.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Computes sin(pi*t), that is, the sine of t measured in half turns.
+
+  Cheaper and more accurate than sin(M_PI*t), since no inexact pi is involved
+  until the argument is already reduced. sinpi of a whole number n is +0 for
+  positive n and -0 for negative n.
+
+*/
+double sinpi(double t){
+  if(__builtin_fabs(t) < HALF_TURN_TINY){
+    return tinyTimesPi(t);
+  }
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return sinpiCore(t);
+}
+
+
+/*
+
+  float version of sinpi. Every float is exact as a double, so it is reduced
+  and evaluated in double precision and rounded once at the end.
+
+*/
+float sinpif(float t){
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return (float)sinpiCore(t);
+}
+
+#endif
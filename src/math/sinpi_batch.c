@@ -0,0 +1,63 @@
+/*
+
+  sinpi_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SINPI_BATCH_C
+#define MATH_SINPI_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/HalfTurnKernel.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Compute y[i] = sinpi(t[i]), cospi(t[i]) or tanpi(t[i]) for i in [0,n).
+
+  Reducing half turns needs no branches at all, not even for huge or
+  non-finite arguments, so unlike sincos_batch these are plain loops over the
+  scalar bodies and vectorize as they are.
+
+  Tiny arguments (below HALF_TURN_TINY) get the scalar functions' results, pi*t
+  or 1, by select. The bodies run on 0 in their place, since on tiny arguments
+  they would underflow into subnormals.
+
+*/
+void sinpi_batch(const double *t, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    uint64_t tiny = __builtin_fabs(t[i]) < HALF_TURN_TINY;
+    double y0 = sinpiCore(selectDouble(tiny, 0, t[i]));
+    y[i] = selectDouble(tiny, tinyTimesPi(selectDouble(tiny, t[i], 0)), y0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void cospi_batch(const double *t, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    uint64_t tiny = __builtin_fabs(t[i]) < HALF_TURN_TINY;
+    double y0 = cospiCore(selectDouble(tiny, 0, t[i]));
+    y[i] = selectDouble(tiny, 1.0, y0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void tanpi_batch(const double *t, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    uint64_t tiny = __builtin_fabs(t[i]) < HALF_TURN_TINY;
+    double y0 = tanpiCore(selectDouble(tiny, 0, t[i]));
+    y[i] = selectDouble(tiny, tinyTimesPi(selectDouble(tiny, t[i], 0)), y0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+
+  sum_reduce.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_SUM_REDUCE_C
+#define MATH_SUM_REDUCE_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/DoubleDouble.c"
+#include "math/FlushSubnormals.c"
+#include "math/Reduce.c"
+
+
+/*
+
+  Returns x[0] + ... + x[n-1], with the compensated summation of Reduce.c in
+  REDUCE_LANES lanes
+
+*/
+double sum_reduce(const double *x, size_t n){
+  double s[REDUCE_LANES], c[REDUCE_LANES];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(int k = 0; k < REDUCE_LANES; k++) s[k] = c[k] = 0;
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int k = 0; k < REDUCE_LANES; k++){
+      reduceAdd(&s[k], &c[k], x[i+k], 0);
+    }
+  }
+  for(int k = 0; i < n; i++, k++){
+    reduceAdd(&s[k], &c[k], x[i], 0);
+  }
+
+  double r = reduceLanes(s, c);
+  flushSubnormalsEnd(flush);
+  return r;
+}
+
+
+/*
+
+  Returns x[0]*y[0] + ... + x[n-1]*y[n-1]. Each product's rounding error is
+  found by mulError and added in with the sum's own (Ogita, Rump and Oishi's
+  Dot2). Without FMA, mulError splits its arguments, which overflows for
+  products near the largest double, and then the errors are dropped and the
+  result is the plain sum of the rounded products.
+
+*/
+double dot_reduce(const double *x, const double *y, size_t n){
+  double s[REDUCE_LANES], c[REDUCE_LANES];
+  uint64_t flush = flushSubnormalsBegin();
+
+  for(int k = 0; k < REDUCE_LANES; k++) s[k] = c[k] = 0;
+
+  size_t i = 0;
+  for(; i + REDUCE_LANES <= n; i += REDUCE_LANES){
+    _Pragma("GCC unroll 1")
+    for(int k = 0; k < REDUCE_LANES; k++){
+      double p = x[i+k]*y[i+k];
+      reduceAdd(&s[k], &c[k], p, mulError(x[i+k], y[i+k], p));
+    }
+  }
+  for(int k = 0; i < n; i++, k++){
+    double p = x[i]*y[i];
+    reduceAdd(&s[k], &c[k], p, mulError(x[i], y[i], p));
+  }
+
+  double r = reduceLanes(s, c);
+  flushSubnormalsEnd(flush);
+  return r;
+}
+
+#endif
@@ -8,9 +8,15 @@
 
 */
 
+#ifndef MATH_TAN_C
+#define MATH_TAN_C
+
 #include "math.h"
-#include "math/cos.c"
-#include "math/sin.c"
+#include "math/TrigReduce.c"
+#include "math/MathErrno.c"
+#include "math/SinKernel.c"
+#include "math/CosKernel.c"
+#include "math/FloatTrigKernel.c"
 
 
 /*
@@ -21,7 +27,51 @@
   https://github.com/lougehrig10/C-Standard-Library/wiki/tan_
 
 */
-double tan(double x){
-  // tan is the relationship between sin and cos
-  return sin(x)/cos(x);
+__MATH_NOCLONE double tan(double x){
+  MATH_STATS_CALL(MATH_STATS_TAN, x);
+
+  if(__builtin_fabs(x) < TRIG_TINY){
+    MATH_STATS_PATH(MATH_STATS_TAN, MATH_STATS_PATH_TINY);
+    return x;
+  }
+
+  // tan of infinity or NaN is NaN, and infinity is a domain error
+  if(x - x != 0){
+    MATH_STATS_PATH(MATH_STATS_TAN, MATH_STATS_PATH_SPECIAL);
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+  MATH_STATS_PATH(MATH_STATS_TAN, TRIG_REDUCE_PATH(x));
+
+  double y0, y1;
+  int n = trigReduce(x, &y0, &y1);
+
+  // tan is the relationship between sin and cos, shifting a quarter of a
+  // circle swaps them and flips the sign
+  double s = sinKernel(y0, y1);
+  double c = cosKernel(y0, y1);
+  return (n & 1) ? -c/s : s/c;
 }
+
+
+
+/*
+
+  float version of tan, as the quotient of the float sine and cosine kernels.
+  Their errors of under 2^-33 leave the quotient well inside float precision.
+
+*/
+__MATH_NOCLONE float tanf(float x){
+  if(x - x != 0){
+    if(x == x) SET_ERRNO(EDOM);
+    return x - x;
+  }
+
+  double y;
+  int n = trigReduceFloat(x, &y);
+  double s = sinFloatKernel(y);
+  double c = cosFloatKernel(y);
+  return (float)((n & 1) ? -c/s : s/c);
+}
+
+#endif
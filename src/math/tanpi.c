@@ -0,0 +1,51 @@
+/*
+
+  tanpi.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_TANPI_C
+#define MATH_TANPI_C
+
+#include "math.h"
+#include "math/HalfTurnKernel.c"
+#include "math/MathErrno.c"
+
+
+/*
+
+  Computes tan(pi*t), that is, the tangent of t measured in half turns.
+
+  Pole error occurs when t is a whole number plus a half
+
+*/
+double tanpi(double t){
+  if(__builtin_fabs(t) < HALF_TURN_TINY){
+    return tinyTimesPi(t);
+  }
+  // Infinite results only come from poles, and NaN from infinite arguments
+  double y = tanpiCore(t);
+  if(__builtin_isinf(y)) SET_ERRNO(ERANGE);
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return y;
+}
+
+
+/*
+
+  float version of tanpi, evaluated in double precision and rounded once.
+  Results close enough to a pole overflow float, which is a range error too.
+
+*/
+float tanpif(float t){
+  float y = (float)tanpiCore(t);
+  if(__builtin_isinf(y)) SET_ERRNO(ERANGE);
+  if(__builtin_isinf(t)) SET_ERRNO(EDOM);
+  return y;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+
+  trig_bounded.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_TRIG_BOUNDED_C
+#define MATH_TRIG_BOUNDED_C
+
+#include "math.h"
+#include <stdint.h>
+#include "math/TrigBoundedKernel.c"
+
+
+/*
+
+  The sine and cosine polynomials on their own, for |x| <= pi/4. No checks and
+  no reduction, so this is the latency of the polynomial and nothing else.
+
+*/
+double __sin_kernel(double x){
+  return sinKernel(x, 0);
+}
+
+double __cos_kernel(double x){
+  return cosKernel(x, 0);
+}
+
+
+/*
+
+  sin and cos for |x| <= pi, without the checks for tiny, infinite and NaN
+  arguments, and with the cheaper reduction of trigReduceBounded in place of
+  trigReduce
+
+*/
+double sin_bounded(double x){
+  return trigBoundedCore(x, 0);
+}
+
+double cos_bounded(double x){
+  return trigBoundedCore(x, 1);
+}
+
+#endif
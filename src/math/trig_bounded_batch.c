@@ -0,0 +1,59 @@
+/*
+
+  trig_bounded_batch.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_TRIG_BOUNDED_BATCH_C
+#define MATH_TRIG_BOUNDED_BATCH_C
+
+#include "math.h"
+#include <stddef.h>
+#include "math/TrigBoundedKernel.c"
+#include "math/FlushSubnormals.c"
+
+
+/*
+
+  Array forms of trig_bounded.c. Nothing in them branches, so these are plain
+  loops over the kernels the scalar forms call and vectorize as they are, like
+  sinpi_batch.
+
+*/
+void __sin_kernel_batch(const double *x, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = sinKernel(x[i], 0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void __cos_kernel_batch(const double *x, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = cosKernel(x[i], 0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void sin_bounded_batch(const double *x, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = trigBoundedCore(x[i], 0);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+void cos_bounded_batch(const double *x, double *y, size_t n){
+  uint64_t flush = flushSubnormalsBegin();
+  for(size_t i = 0; i < n; i++){
+    y[i] = trigBoundedCore(x[i], 1);
+  }
+  flushSubnormalsEnd(flush);
+}
+
+#endif
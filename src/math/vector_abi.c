@@ -0,0 +1,192 @@
+/*
+
+  vector_abi.c
+
+  Gehrig Wilcox
+
+  10/19/26
+
+*/
+
+#ifndef MATH_VECTOR_ABI_C
+#define MATH_VECTOR_ABI_C
+
+#include "math.h"
+#include <float.h>
+#include <stdint.h>
+#include "math/FloatBits.c"
+#include "math/TrigReduce.c"
+#include "math/SincosKernel.c"
+#include "math/FloatTrigKernel.c"
+#include "math/ExpKernel.c"
+#include "math/LogKernel.c"
+
+
+/*
+
+  Vector variants of cos, sin, tan, exp and log, and of cosf, sinf and tanf,
+  under the names of the x86-64 vector function ABI (the one libmvec and
+  Intel's compilers use), which is what GCC calls for the math.h declarations
+  marked __MATH_SIMD when it vectorizes a loop over them. A name like
+  _ZGVdN4v_cos is cos (_cos) for one vector argument (v) of four lanes (N4),
+  unmasked (N), for AVX2 (d). b, c, d and e are SSE2, AVX, AVX2 and AVX-512,
+  and there is one of each for every function, since a compiler targeting one
+  of them calls that variant.
+
+  Each variant runs the branch-free body of its function on every lane,
+  inlined and compiled for its instruction set (so with FMA from AVX2 on),
+  the same way the batch functions run it on every element. Lanes that need
+  the scalar function's other paths (huge or non-finite arguments, and for
+  log, non-positive and subnormal ones) are given a harmless argument
+  instead, then redone afterwards by the scalar function, which also sets
+  errno for them as a scalar call would.
+
+*/
+typedef double vdouble2 __attribute__((vector_size(16)));
+typedef double vdouble4 __attribute__((vector_size(32)));
+typedef double vdouble8 __attribute__((vector_size(64)));
+typedef float vfloat4 __attribute__((vector_size(16)));
+typedef float vfloat8 __attribute__((vector_size(32)));
+typedef float vfloat16 __attribute__((vector_size(64)));
+
+
+/*
+
+  Lane bodies: whether x needs the scalar function, and the value for x
+  otherwise
+
+*/
+static inline uint64_t trigVectorSpecial(double x){
+  return !__builtin_isless(__builtin_fabs(x), TRIG_REDUCE_MEDIUM);
+}
+
+static inline double sinVector(double x){
+  double y0, y1;
+  uint64_t n = (uint64_t)trigReduceMedium(x, &y0, &y1);
+  return trigQuadrant(n, y0, y1);
+}
+
+static inline double cosVector(double x){
+  double y0, y1;
+  uint64_t n = (uint64_t)trigReduceMedium(x, &y0, &y1);
+  return trigQuadrant(n + 1, y0, y1);
+}
+
+static inline double tanVector(double x){
+  double y0, y1;
+  uint64_t n = (uint64_t)trigReduceMedium(x, &y0, &y1);
+  double s = sinKernel(y0, y1);
+  double c = cosKernel(y0, y1);
+  return selectDouble(n & 1, -c, s)/selectDouble(n & 1, s, c);
+}
+
+// Past 708 either way e^x may overflow or underflow, which exp reports
+static inline uint64_t expVectorSpecial(double x){
+  return !__builtin_isless(__builtin_fabs(x), 708);
+}
+
+static inline uint64_t logVectorSpecial(double x){
+  return !(__builtin_isgreaterequal(x, DBL_MIN) &
+           __builtin_islessequal(x, DBL_MAX));
+}
+
+static inline double logVector(double x){
+  double f;
+  double k = logReduce(x, &f);
+  return logKernel(k, f, 0);
+}
+
+static inline uint32_t trigVectorSpecialf(float x){
+  return !__builtin_isless(__builtin_fabsf(x), TRIG_REDUCE_MEDIUM);
+}
+
+static inline double trigVectorf(float x, uint64_t cosine){
+  double y0, y1;
+  uint64_t n = (uint64_t)trigReduceMedium(x, &y0, &y1) + cosine;
+  double s = sinFloatKernel(y0);
+  double c = cosFloatKernel(y0);
+  double y = selectDouble(n & 1, c, s);
+  return selectDouble(n & 2, -y, y);
+}
+
+static inline float sinVectorf(float x){
+  return (float)trigVectorf(x, 0);
+}
+
+static inline float cosVectorf(float x){
+  return (float)trigVectorf(x, 1);
+}
+
+static inline float tanVectorf(float x){
+  double y0, y1;
+  uint64_t n = (uint64_t)trigReduceMedium(x, &y0, &y1);
+  double s = sinFloatKernel(y0);
+  double c = cosFloatKernel(y0);
+  return (float)(selectDouble(n & 1, -c, s)/selectDouble(n & 1, s, c));
+}
+
+
+/*
+
+  VECTOR_FUNCTION stamps out the four variants of FN, for N1, N2 and N4 lanes
+  of type T (VT1, VT2 and VT4 being the vectors of them), and the pass that
+  redoes their special lanes with calls to FN itself. That pass is kept out of
+  line so that the common case pays only for the test.
+
+  In VECTOR_VARIANT, TEST says whether a lane is special (as a U, the
+  unsigned integer of T's width, for SELECT) and LANE computes the rest.
+  Special lanes are given the argument SAFE, which LANE takes without raising
+  anything, so that one NaN doesn't cost the others.
+
+*/
+#define VECTOR_VARIANT(NAME, FN, T, U, VT, N, TARGET, SELECT, TEST, LANE,     \
+                       SAFE)                                                   \
+__attribute__((target(TARGET))) VT NAME(VT v){                                 \
+  union { VT v; T a[N]; } x = { v }, y;                                        \
+  U special = 0;                                                               \
+  _Pragma("GCC unroll 1")                                                      \
+  for(int i = 0; i < N; i++){                                                  \
+    U test = TEST(x.a[i]);                                                     \
+    special |= test;                                                           \
+    y.a[i] = LANE(SELECT(test, SAFE, x.a[i]));                                 \
+  }                                                                            \
+  if(special) FN##VectorScalar(x.a, y.a, N);                                   \
+  return y.v;                                                                  \
+}
+
+#define VECTOR_FUNCTION(FN, T, U, N1, N2, N4, VT1, VT2, VT4, SELECT, TEST,    \
+                        LANE, SAFE)                                            \
+static __attribute__((noinline))                                              \
+void FN##VectorScalar(const T *x, T *y, int n){                                \
+  for(int i = 0; i < n; i++){                                                  \
+    if(TEST(x[i])) y[i] = FN(x[i]);                                            \
+  }                                                                            \
+}                                                                              \
+VECTOR_VARIANT(_ZGVbN##N1##v_##FN, FN, T, U, VT1, N1, "sse2", SELECT, TEST,   \
+               LANE, SAFE)                                                     \
+VECTOR_VARIANT(_ZGVcN##N2##v_##FN, FN, T, U, VT2, N2, "avx", SELECT, TEST,    \
+               LANE, SAFE)                                                     \
+VECTOR_VARIANT(_ZGVdN##N2##v_##FN, FN, T, U, VT2, N2, "avx2,fma", SELECT,     \
+               TEST, LANE, SAFE)                                               \
+VECTOR_VARIANT(_ZGVeN##N4##v_##FN, FN, T, U, VT4, N4, "avx512f", SELECT,      \
+               TEST, LANE, SAFE)
+
+#define VECTOR_DOUBLE(FN, TEST, LANE, SAFE)                                    \
+VECTOR_FUNCTION(FN, double, uint64_t, 2, 4, 8, vdouble2, vdouble4, vdouble8,  \
+                selectDouble, TEST, LANE, SAFE)
+
+#define VECTOR_FLOAT(FN, TEST, LANE, SAFE)                                     \
+VECTOR_FUNCTION(FN, float, uint32_t, 4, 8, 16, vfloat4, vfloat8, vfloat16,    \
+                selectFloat, TEST, LANE, SAFE)
+
+VECTOR_DOUBLE(cos, trigVectorSpecial, cosVector, 0)
+VECTOR_DOUBLE(sin, trigVectorSpecial, sinVector, 0)
+VECTOR_DOUBLE(tan, trigVectorSpecial, tanVector, 0)
+VECTOR_DOUBLE(exp, expVectorSpecial, expKernel, 0)
+VECTOR_DOUBLE(log, logVectorSpecial, logVector, 1)
+
+VECTOR_FLOAT(cosf, trigVectorSpecialf, cosVectorf, 0)
+VECTOR_FLOAT(sinf, trigVectorSpecialf, sinVectorf, 0)
+VECTOR_FLOAT(tanf, trigVectorSpecialf, tanVectorf, 0)
+
+#endif
@@ -0,0 +1,630 @@
+/*
+
+  remez.c
+
+  Generates the minimax coefficient tables used by the kernels.
+
+  Each table is a polynomial P, of a given number of terms, that approximates
+  one of the functions listed in targets[] below on an interval, in the form
+  the kernel evaluates it (sin(x) = x + x^3*P(x^2), for instance). P is found
+  with the Remez exchange algorithm in long double, its coefficients are
+  rounded to float or double one at a time (refitting the rest after each, so
+  they make up for the rounding), and the error of the rounded polynomial is
+  measured and written out with the table.
+
+  The output is a source file holding the tables as static const arrays, each
+  with a NAME_ERROR macro for its error bound, which the kernels include like
+  any other file in src/math. Regenerating a table with more or fewer terms, or
+  for another interval or type, is how the speed and accuracy of a kernel are
+  traded, rather than editing constants by hand.
+
+    cc -O2 tools/remez.c -lm -o remez
+    ./remez output.c NAME=function,terms,lo,hi,type ...
+
+  for example
+
+    ./remez src/math/HalfPoly.c \
+        SIN_HALF_POLY=sin,3,-0.7854,0.7854,float
+
+  The command that made a file is copied into its header comment. Double
+  tables need a long double wider than double (x87 or binary128) to come out
+  right.
+
+  Gehrig Wilcox
+  10/19/26
+
+*/
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Most terms in a table, and most points the error is sampled at per term
+#define REMEZ_MAX_TERMS 24
+#define REMEZ_SAMPLES 512
+
+// Remez stops once the extrema agree to this, or after REMEZ_ITERATIONS
+#define REMEZ_TOLERANCE 1e-12L
+#define REMEZ_ITERATIONS 100
+
+/*
+
+  Where the error is tiny its sign can flip between neighbouring samples from
+  rounding alone, so there can be a run of the same sign (and an extremum) for
+  every sample
+
+*/
+#define REMEZ_MAX_EXTREMA (REMEZ_SAMPLES*REMEZ_MAX_TERMS + 2)
+
+static long double extremumAt[REMEZ_MAX_EXTREMA];
+static long double extremumValue[REMEZ_MAX_EXTREMA];
+
+
+/*
+
+  What a table approximates.
+
+  A kernel evaluates f(x) = lead(x) + scale(x)*P(t), where t is x^2 for the
+  odd and even functions and x otherwise. The table is fit to
+
+    h(t) = (f(x) - lead(x)) / scale(x)
+
+  minimizing the largest weighted error w(t)*(P(t) - h(t)), where w(t) is
+  chosen so that the weighted error is the relative error that P's error
+  causes in f. Each h is written so that it doesn't cancel near 0 (as a
+  series where it would), since the fit can't be better than h is.
+
+*/
+struct target {
+  const char *name;
+  const char *form;
+  int even;
+  long double (*h)(long double t);
+  long double (*w)(long double t);
+};
+
+
+/*
+
+  Sum of sign^k * z^k/(first+2k)! for k = 0, 1, 2, ..., which is where all of
+  the trig targets come from
+
+*/
+static long double trigSeries(long double z, int first, int sign){
+  long double term = 1;
+  for(int i = 2; i <= first; i++) term /= i;
+
+  long double sum = 0;
+  for(int k = 0; k < 40; k++){
+    sum += term;
+    term *= sign*z / ((first+2*k+1) * (first+2*k+2));
+  }
+  return sum;
+}
+
+// sin(x) = x + x^3*P(x^2)
+static long double sinH(long double z){
+  return -trigSeries(z, 3, -1);
+}
+
+static long double sinW(long double z){
+  long double x = sqrtl(z);
+  return z == 0 ? 0 : z*x/sinl(x);
+}
+
+// cos(x) = 1 - x^2/2 + x^4*P(x^2)
+static long double cosH(long double z){
+  return trigSeries(z, 4, -1);
+}
+
+static long double cosW(long double z){
+  return z*z/cosl(sqrtl(z));
+}
+
+// cos(x) = 1 + x^2*P(x^2)
+static long double cos1H(long double z){
+  return -trigSeries(z, 2, -1);
+}
+
+static long double cos1W(long double z){
+  return z/cosl(sqrtl(z));
+}
+
+// exp(x) = P(x)
+static long double expH(long double x){
+  return expl(x);
+}
+
+static long double expW(long double x){
+  return 1/expl(x);
+}
+
+// exp(x) = 1 + x + x^2*P(x), the sum of x^k/(k+2)!
+static long double expm1H(long double x){
+  long double term = 0.5L, sum = 0;
+  for(int k = 0; k < 40; k++){
+    sum += term;
+    term *= x/(k+3);
+  }
+  return sum;
+}
+
+static long double expm1W(long double x){
+  return x*x/expl(x);
+}
+
+
+/*
+
+  log(1+f) = 2s + s^3*P(s^2), where s = f/(2+f) and log(1+f) = 2*atanh(s). The
+  interval is in s.
+
+*/
+static long double logH(long double z){
+  long double power = 1, sum = 0;
+  for(int k = 0; k < 60; k++){
+    sum += power/(2*k+3);
+    power *= z;
+  }
+  return 2*sum;
+}
+
+static long double logW(long double z){
+  long double s = sqrtl(z);
+  return z == 0 ? 0 : z*s/(2*atanhl(s));
+}
+
+// atan(x) = x + x^3*P(x^2)
+static long double atanH(long double z){
+  long double power = 1, sum = 0;
+  for(int k = 0; k < 200 && power > 1e-40L; k++){
+    sum += (k & 1 ? 1 : -1)*power/(2*k+3);
+    power *= z;
+  }
+  return sum;
+}
+
+static long double atanW(long double z){
+  long double x = sqrtl(z);
+  return z == 0 ? 0 : z*x/atanl(x);
+}
+
+
+/*
+
+  tanh(x) = x + x^3*P(x^2). tanh(x) - x is (sinh(x) - x*cosh(x))/cosh(x), and
+  the series of the numerator, sum of -2k*x^(2k+1)/(2k+1)! from k = 1, has no
+  cancellation in it.
+
+*/
+static long double tanhH(long double z){
+  long double term = 1.0L/6, sum = 0;
+  for(int k = 1; k < 40; k++){
+    sum -= 2*k*term;
+    term *= z / ((2*k+2) * (2*k+3));
+  }
+  return sum/coshl(sqrtl(z));
+}
+
+static long double tanhW(long double z){
+  long double x = sqrtl(z);
+  return z == 0 ? 0 : z*x/tanhl(x);
+}
+
+
+static const struct target targets[] = {
+  { "sin",  "sin(x) = x + x^3*P(x^2)",         1, sinH,  sinW  },
+  { "cos",  "cos(x) = 1 - x^2/2 + x^4*P(x^2)", 1, cosH,  cosW  },
+  { "cos1", "cos(x) = 1 + x^2*P(x^2)",         1, cos1H, cos1W },
+  { "exp",  "exp(x) = P(x)",                   0, expH,  expW  },
+  { "expm1", "exp(x) = 1 + x + x^2*P(x)",      0, expm1H, expm1W },
+  { "log",  "log(1+f) = 2s + s^3*P(s^2), s = f/(2+f)", 1, logH, logW },
+  { "atan", "atan(x) = x + x^3*P(x^2)",        1, atanH, atanW },
+  { "tanh", "tanh(x) = x + x^3*P(x^2)",        1, tanhH, tanhW }
+};
+
+#define TARGET_COUNT (int)(sizeof(targets)/sizeof(targets[0]))
+
+
+/*
+
+  One table to generate, as given on the command line. c[] holds the
+  coefficients, c[0] being the constant term, and fixed how many of them have
+  been rounded so far.
+
+*/
+struct table {
+  char name[64];
+  const struct target *target;
+  int terms, isFloat, fixed;
+  long double lo, hi;
+  long double c[REMEZ_MAX_TERMS];
+  long double error;
+};
+
+
+static long double evaluate(const struct table *t, long double x){
+  long double r = 0;
+  for(int i = t->terms-1; i >= 0; i--) r = r*x + t->c[i];
+  return r;
+}
+
+// Weighted error of the table at t
+static long double weightedError(const struct table *t, long double x){
+  return t->target->w(x) * (evaluate(t, x) - t->target->h(x));
+}
+
+
+/*
+
+  Solves the n by n system a*x = b in place by Gaussian elimination with
+  partial pivoting. Returns 0 if the system is singular.
+
+*/
+static int solve(long double a[][REMEZ_MAX_TERMS+1], long double *b, int n){
+  for(int k = 0; k < n; k++){
+    int p = k;
+    for(int i = k+1; i < n; i++){
+      if(fabsl(a[i][k]) > fabsl(a[p][k])) p = i;
+    }
+    if(a[p][k] == 0) return 0;
+
+    for(int j = 0; j < n; j++){
+      long double s = a[k][j]; a[k][j] = a[p][j]; a[p][j] = s;
+    }
+    long double s = b[k]; b[k] = b[p]; b[p] = s;
+
+    for(int i = k+1; i < n; i++){
+      long double m = a[i][k]/a[k][k];
+      for(int j = k; j < n; j++) a[i][j] -= m*a[k][j];
+      b[i] -= m*b[k];
+    }
+  }
+
+  for(int k = n-1; k >= 0; k--){
+    for(int j = k+1; j < n; j++) b[k] -= a[k][j]*b[j];
+    b[k] /= a[k][k];
+  }
+  return 1;
+}
+
+
+/*
+
+  Fits the free coefficients c[fixed] to c[terms-1] so that the weighted error
+  equioscillates at the m = terms-fixed+1 points of the reference ref[]:
+
+    w(r)*(P(r) - h(r)) = (-1)^j * E   for every r = ref[j]
+
+  which is linear in the coefficients and E.
+
+*/
+static int fitReference(struct table *t, const long double *ref){
+  long double a[REMEZ_MAX_TERMS+1][REMEZ_MAX_TERMS+1];
+  long double b[REMEZ_MAX_TERMS+1];
+  int free = t->terms - t->fixed, m = free+1;
+
+  for(int j = 0; j < m; j++){
+    long double x = ref[j], w = t->target->w(x);
+    long double fixedPart = 0;
+    for(int i = t->fixed-1; i >= 0; i--) fixedPart = fixedPart*x + t->c[i];
+
+    long double power = powl(x, t->fixed);
+    for(int i = 0; i < free; i++){
+      a[j][i] = w*power;
+      power *= x;
+    }
+    a[j][free] = j & 1 ? 1 : -1;
+    b[j] = w*(t->target->h(x) - fixedPart);
+  }
+
+  if(!solve(a, b, m)) return 0;
+  for(int i = 0; i < free; i++) t->c[t->fixed+i] = b[i];
+  return 1;
+}
+
+
+/*
+
+  Largest weighted error in [a,b], which holds a single extremum, by golden
+  section search on its magnitude
+
+*/
+static long double refineExtremum(const struct table *t, long double a,
+                                  long double b, long double *at){
+  const long double g = 0.6180339887498948482L;
+  long double x1 = b - g*(b-a), x2 = a + g*(b-a);
+  long double f1 = fabsl(weightedError(t, x1));
+  long double f2 = fabsl(weightedError(t, x2));
+
+  for(int i = 0; i < 80; i++){
+    if(f1 > f2){
+      b = x2; x2 = x1; f2 = f1;
+      x1 = b - g*(b-a); f1 = fabsl(weightedError(t, x1));
+    }else{
+      a = x1; x1 = x2; f1 = f2;
+      x2 = a + g*(b-a); f2 = fabsl(weightedError(t, x2));
+    }
+  }
+
+  *at = f1 > f2 ? x1 : x2;
+  return weightedError(t, *at);
+}
+
+
+/*
+
+  Finds the extrema of the weighted error: one for each run of samples of the
+  same sign, refined between the neighbouring samples. Returns how many there
+  are, up to max, and the largest magnitude among them in *largest.
+
+*/
+static int findExtrema(const struct table *t, long double *at,
+                       long double *value, int max, long double *largest){
+  int samples = REMEZ_SAMPLES*t->terms;
+  long double step = (t->hi - t->lo)/samples;
+  int count = 0;
+  long double best = 0, bestAt = t->lo;
+  int sign = 0;
+
+  *largest = 0;
+  for(int i = 0; i <= samples+1; i++){
+    long double x = i == samples ? t->hi : t->lo + i*step;
+    long double e = i <= samples ? weightedError(t, x) : 0;
+    int s = e > 0 ? 1 : e < 0 ? -1 : sign;
+
+    // A run ends where the sign changes (or the samples do)
+    if(i > samples || (sign != 0 && s != sign)){
+      if(count < max){
+        long double a = bestAt - step < t->lo ? t->lo : bestAt - step;
+        long double b = bestAt + step > t->hi ? t->hi : bestAt + step;
+        long double refined = refineExtremum(t, a, b, &at[count]);
+
+        // The bracket reaches into the neighbouring runs, keep to this one
+        if(refined*best > 0 && fabsl(refined) > fabsl(best)){
+          value[count] = refined;
+        }else{
+          value[count] = best;
+          at[count] = bestAt;
+        }
+        if(fabsl(value[count]) > *largest) *largest = fabsl(value[count]);
+      }
+      count++;
+      best = 0;
+    }
+
+    if(fabsl(e) > fabsl(best)){
+      best = e;
+      bestAt = x;
+    }
+    sign = s;
+  }
+
+  return count < max ? count : max;
+}
+
+
+/*
+
+  Runs the exchange algorithm for the free coefficients, starting from the
+  Chebyshev nodes of the interval. Each pass fits the reference, then moves it
+  to the extrema of the new error, dropping the smaller end extremum while
+  there are too many.
+
+  Once the error gets down to what long double can resolve, the passes stop
+  converging and wander, so the coefficients kept are those of the pass with
+  the smallest largest error. Returns 0 if the first fit breaks down.
+
+*/
+static int remez(struct table *t){
+  long double ref[REMEZ_MAX_TERMS+1], best[REMEZ_MAX_TERMS];
+  long double bestError = INFINITY;
+  long double *at = extremumAt, *value = extremumValue;
+  int m = t->terms - t->fixed + 1;
+  long double pi = 3.14159265358979323846264338327950288L;
+
+  for(int j = 0; j < m; j++){
+    long double c = cosl(pi*(2*(m-1-j)+1)/(2*m));
+    ref[j] = 0.5L*(t->lo + t->hi) + 0.5L*(t->hi - t->lo)*c;
+  }
+
+  for(int pass = 0; pass < REMEZ_ITERATIONS; pass++){
+    if(!fitReference(t, ref)) break;
+
+    long double largest;
+    int n = findExtrema(t, at, value, REMEZ_MAX_EXTREMA, &largest);
+    if(largest < bestError){
+      bestError = largest;
+      memcpy(best, t->c, sizeof(best));
+    }
+    if(n < m) break;
+
+    int first = 0;
+    while(n > m){
+      if(fabsl(value[first]) < fabsl(value[first+n-1])) first++;
+      n--;
+    }
+
+    long double smallest = largest;
+    for(int j = 0; j < m; j++){
+      ref[j] = at[first+j];
+      if(fabsl(value[first+j]) < smallest) smallest = fabsl(value[first+j]);
+    }
+    if(largest - smallest <= REMEZ_TOLERANCE*largest) break;
+  }
+
+  if(bestError == INFINITY) return 0;
+  memcpy(t->c, best, sizeof(best));
+  return 1;
+}
+
+
+/*
+
+  Fits the table, then rounds its coefficients to float or double from the
+  constant term up, fitting the ones above again after each so that they
+  absorb its rounding error. The error of the rounded table is measured last.
+
+*/
+static int generate(struct table *t){
+  for(t->fixed = 0; t->fixed < t->terms; t->fixed++){
+    if(!remez(t)) return 0;
+    long double c = t->c[t->fixed];
+    t->c[t->fixed] = t->isFloat ? (long double)(float)c
+                                : (long double)(double)c;
+  }
+
+  findExtrema(t, extremumAt, extremumValue, REMEZ_MAX_EXTREMA, &t->error);
+  return 1;
+}
+
+
+/*
+
+  Parses NAME=function,terms,lo,hi,type. lo and hi are bounds on x, which
+  become bounds on x^2 for the even targets.
+
+*/
+static int parseTable(const char *arg, struct table *t){
+  char function[16], type[8];
+  memset(t, 0, sizeof(*t));
+
+  const char *eq = strchr(arg, '=');
+  if(!eq || eq == arg || eq - arg >= (long)sizeof(t->name)) return 0;
+  memcpy(t->name, arg, eq - arg);
+
+  if(sscanf(eq+1, "%15[^,],%d,%Lf,%Lf,%7s", function, &t->terms, &t->lo,
+            &t->hi, type) != 5){
+    return 0;
+  }
+  if(t->terms < 1 || t->terms > REMEZ_MAX_TERMS || !(t->lo < t->hi)) return 0;
+
+  if(strcmp(type, "float") == 0) t->isFloat = 1;
+  else if(strcmp(type, "double") != 0) return 0;
+
+  for(int i = 0; i < TARGET_COUNT; i++){
+    if(strcmp(function, targets[i].name) == 0) t->target = &targets[i];
+  }
+  if(!t->target) return 0;
+
+  if(t->target->even){
+    long double a = t->lo*t->lo, b = t->hi*t->hi;
+    long double top = a > b ? a : b;
+    t->lo = t->lo <= 0 && t->hi >= 0 ? 0 : a < b ? a : b;
+    t->hi = top;
+  }
+  return 1;
+}
+
+
+/*
+
+  Rounds an error up to three significant bits, so the bound written out is
+  never below the one measured
+
+*/
+static double roundUp(long double e){
+  int exponent;
+  long double m = frexpl(e, &exponent);
+  return (double)ldexpl(ceill(m*8)/8, exponent);
+}
+
+// The name of the guard macro for a file: src/math/HalfPoly.c -> HALFPOLY_C
+static void guardName(const char *path, char *guard, size_t size){
+  const char *base = strrchr(path, '/');
+  base = base ? base+1 : path;
+
+  size_t i = 0;
+  for(; base[i] && i+1 < size; i++){
+    char ch = base[i];
+    guard[i] = ch >= 'a' && ch <= 'z' ? ch - 'a' + 'A' : ch == '.' ? '_' : ch;
+  }
+  guard[i] = 0;
+}
+
+
+static void writeTable(FILE *out, const struct table *t){
+  const char *type = t->isFloat ? "float" : "double";
+  const char *suffix = t->isFloat ? "f" : "";
+  long double x = t->target->even ? sqrtl(t->hi) : t->hi;
+
+  fprintf(out, "\n\n/*\n\n  %s", t->target->form);
+  if(t->target->even) fprintf(out, " on [-%.10Lg,%.10Lg]", x, x);
+  else fprintf(out, " on [%.10Lg,%.10Lg]", t->lo, t->hi);
+  fprintf(out, ",\n  relative error at most 2^%.1Lf\n\n*/\n",
+          log2l(t->error));
+
+  fprintf(out, "static const %s %s[%d] CACHE_ALIGNED = {\n", type, t->name,
+          t->terms);
+  for(int i = 0; i < t->terms; i++){
+    double c = (double)t->c[i];
+    fprintf(out, "  %s%a%s%s\n", c < 0 ? "" : " ", c, suffix,
+            i+1 < t->terms ? "," : "");
+  }
+  fprintf(out, "};\n\n#define %s_ERROR %a\n", t->name, roundUp(t->error));
+}
+
+
+int main(int argc, char **argv){
+  if(argc < 3){
+    fprintf(stderr, "usage: %s output.c NAME=function,terms,lo,hi,type ...\n",
+            argv[0]);
+    fprintf(stderr, "functions:");
+    for(int i = 0; i < TARGET_COUNT; i++){
+      fprintf(stderr, "  %s: %s\n", targets[i].name, targets[i].form);
+    }
+    return 2;
+  }
+
+  if(LDBL_MANT_DIG <= DBL_MANT_DIG){
+    fprintf(stderr, "warning: long double is no wider than double, double "
+                    "tables will be off in their last bits\n");
+  }
+
+  int count = argc-2;
+  struct table *tables = calloc(count, sizeof(struct table));
+  if(!tables){
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  for(int i = 0; i < count; i++){
+    if(!parseTable(argv[i+2], &tables[i])){
+      fprintf(stderr, "bad table: %s\n", argv[i+2]);
+      return 2;
+    }
+    if(!generate(&tables[i])){
+      fprintf(stderr, "%s: the fit broke down\n", tables[i].name);
+      return 1;
+    }
+    fprintf(stderr, "%s: error 2^%.2Lf\n", tables[i].name,
+            log2l(tables[i].error));
+  }
+
+  FILE *out = fopen(argv[1], "w");
+  if(!out){
+    perror(argv[1]);
+    return 1;
+  }
+
+  const char *base = strrchr(argv[1], '/');
+  char guard[64];
+  guardName(argv[1], guard, sizeof(guard));
+
+  fprintf(out, "/*\n\n  %s\n\n  Generated by tools/remez.c, do not edit. To "
+               "regenerate:\n\n    remez %s", base ? base+1 : argv[1], argv[1]);
+  for(int i = 2; i < argc; i++) fprintf(out, " \\\n      %s", argv[i]);
+  fprintf(out, "\n\n*/\n\n#ifndef MATH_%s\n#define MATH_%s\n\n", guard,
+          guard);
+  fprintf(out, "#include \"math/CacheLine.c\"\n");
+
+  for(int i = 0; i < count; i++) writeTable(out, &tables[i]);
+
+  fprintf(out, "\n#endif\n");
+  fclose(out);
+  free(tables);
+  return 0;
+}